@@ -0,0 +1,137 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief A macro which provides a CPU-mangled name for configuration key with name `name`
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables concurrent execution of independent graph branches inside one infer request.
+ * Nodes which don't depend on each other are executed in parallel within the stream's threads.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ * @note Takes effect only for TBB threading
+ */
+DECLARE_CPU_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+ * @brief The key sets the number of graphs specialized for input shapes which differ from the ones the network
+ * was loaded with. The graphs are kept per stream and the least recently used one is dropped when the limit is
+ * reached. Specialized graphs share constant weights with the original one.
+ * This option should be used with non-negative integer values. Zero (default) disables the cache, so input blobs
+ * must match the network input dimensions.
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_CACHE_SIZE);
+
+/**
+ * @brief The key sets comma separated sizes which input dimensions are rounded up to before a specialized graph
+ * is looked up, e.g. "32,64,128". Every input dimension which differs from the one the network was loaded with
+ * is increased to the closest bucket size and the input data is padded with zeros, so output blobs are produced
+ * for the padded shape. Dimensions bigger than the largest bucket are not changed.
+ * Empty value (default) disables bucketing. Takes effect only if CPU_SHAPE_CACHE_SIZE is not zero.
+ */
+DECLARE_CPU_CONFIG_KEY(SHAPE_BUCKETS);
+
+/**
+ * @brief The key enables JIT code generation for subgraphs of elementwise operations. Chains of elementwise
+ * operations are collapsed into a single node and compiled to one kernel, so intermediate results stay in registers.
+ * Subgraphs the kernel can't be generated for are evaluated by the reference implementation.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(SNIPPETS);
+
+/**
+ * @brief The key sets how many times an idle stream thread polls for new infer requests before it is put to sleep.
+ * Polling reduces the latency of request start at high request rates at the cost of CPU time spent by idle threads.
+ * This option should be used with non-negative integer values. Zero (default) puts idle threads to sleep immediately.
+ */
+DECLARE_CPU_CONFIG_KEY(STREAMS_SPIN_COUNT);
+
+/**
+ * @brief The key keeps 8-bit weights of FullyConnected (MatMul) layers compressed instead of decompressing them to
+ * FP32 at load time. Weights given as Constant (i8/u8) -> Convert -> [Subtract] -> Multiply are stored with per output
+ * channel scales and shifts and dequantized by the kernel on the fly, activations stay in FP32. Weights which values
+ * fit in 4 bits are additionally packed by two per byte. Takes effect only if low precision transformations aren't
+ * applied to the network and the platform supports AVX2.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_COMPRESSION);
+
+/**
+ * @brief The key sets the maximum number of infer requests which are coalesced into one inference. Requests started
+ * concurrently are held until this number of them is collected or CPU_AUTO_BATCH_TIMEOUT expires, then their inputs
+ * are concatenated along the outermost dimension and the network reshaped to the bigger batch is inferred once.
+ * All network inputs and outputs must have batch 1 in the outermost dimension and the network must process batch
+ * items independently. Requests which blobs differ from the network ones are inferred by themselves.
+ * This option should be used with non-negative integer values. Zero and one (default) disable the batching.
+ * @note Doesn't take effect if dynamic batch is enabled or the network has states
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_BATCH_SIZE);
+
+/**
+ * @brief The key sets the maximum time in microseconds an infer request is held to be coalesced with other ones
+ * when CPU_AUTO_BATCH_SIZE is set. Bigger values increase the average batch at the cost of the request latency.
+ * This option should be used with non-negative integer values. Default value is 1000.
+ */
+DECLARE_CPU_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
+/**
+ * @brief The key sets the number of streams of the executor which runs input pre-processing (resize, color
+ * conversion) of infer requests as a separate stage of the asynchronous pipeline, so the pre-processing of a request
+ * overlaps with the inference of the other ones.
+ * This option should be used with non-negative integer values. Zero (default) runs the pre-processing as a part of
+ * the inference.
+ */
+DECLARE_CPU_CONFIG_KEY(PREPROCESSING_STREAMS);
+
+}  // namespace CPUConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of executable network to get the average number of tasks per second submitted to the CPU streams,
+ * String value is METRIC_CPU_STREAMS_TASK_RATE
+ */
+DECLARE_METRIC_KEY(CPU_STREAMS_TASK_RATE, float);
+
+/**
+ * @brief Metric of executable network to get the average time in microseconds a task waits for a free CPU stream,
+ * String value is METRIC_CPU_STREAMS_QUEUE_WAIT_TIME
+ */
+DECLARE_METRIC_KEY(CPU_STREAMS_QUEUE_WAIT_TIME, float);
+
+/**
+ * @brief Metric of executable network to get the memory in bytes placed on each NUMA node: activations and
+ * constants of the stream graphs and blobs of the infer requests created for the node,
+ * String value is METRIC_CPU_NUMA_MEMORY_FOOTPRINT
+ */
+DECLARE_METRIC_KEY(CPU_NUMA_MEMORY_FOOTPRINT, std::map<int, std::uint64_t>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
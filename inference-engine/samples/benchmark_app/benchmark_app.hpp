@@ -81,6 +81,19 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for warmup option
+static const char warmup_message[] = "Optional. Number of warm-up iterations executed after the first inference. "
+                                     "Warm-up iterations are reported separately and excluded from the performance results. "
+                                     "Default value is 0.";
+
+// @brief message for latency_hist option
+static const char latency_hist_message[] = "Optional. Number of bins of the latency histogram to print and to store in the statistics report. "
+                                           "Default value is 0 that means the histogram is not collected.";
+
+// @brief message for timeline option
+static const char timeline_message[] = "Optional. Dump start and end timestamps of each executed infer request to "
+                                       "benchmark_timeline.<csv/json> file in the report folder. Requires -report_type to be set.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
@@ -172,6 +185,15 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Number of warm-up iterations excluded from the results
+DEFINE_uint32(warmup, 0, warmup_message);
+
+/// @brief Number of latency histogram bins
+DEFINE_uint32(latency_hist, 0, latency_hist_message);
+
+/// @brief Format of per-request timeline dump
+DEFINE_string(timeline, "", timeline_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -222,6 +244,7 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << "    -warmup \"<integer>\"       " << warmup_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -230,6 +253,8 @@ static void showUsage() {
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -latency_hist \"<integer>\" " << latency_hist_message << std::endl;
+    std::cout << "    -timeline \"<csv/json>\"    " << timeline_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
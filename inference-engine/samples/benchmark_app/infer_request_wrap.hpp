@@ -70,6 +70,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
     Time::time_point _startTime;
@@ -87,6 +95,7 @@ public:
                                                                                  std::placeholders::_2)));
             _idleIds.push(id);
         }
+        _originTime = Time::now();
         resetTimes();
     }
     ~InferRequestsQueue() {
@@ -102,6 +111,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _timeline.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +122,11 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        auto toMilliseconds = [this] (const Time::time_point& time) {
+            return std::chrono::duration_cast<ns>(time - _originTime).count() * 0.000001;
+        };
+        _timeline.push_back({id, toMilliseconds(requests.at(id)->getStartTime()),
+                             toMilliseconds(requests.at(id)->getEndTime()), false});
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,6 +150,12 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns execution records of the requests completed since the last resetTimes() call,
+    /// timestamps are counted from the queue creation so the records of different phases can be merged
+    StatisticsReport::Timeline getTimeline() {
+        return _timeline;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,5 +164,7 @@ private:
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    Time::time_point _originTime;
     std::vector<double> _latencies;
+    StatisticsReport::Timeline _timeline;
 };
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <memory>
 #include <map>
 #include <string>
@@ -67,6 +68,16 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (!FLAGS_timeline.empty()) {
+        if (FLAGS_timeline != csvTimeline && FLAGS_timeline != jsonTimeline) {
+            throw std::logic_error("only " + std::string(csvTimeline) + "/" + std::string(jsonTimeline) +
+                                   " timeline formats are supported (invalid -timeline option value)");
+        }
+        if (FLAGS_report_type.empty()) {
+            throw std::logic_error("-timeline option requires -report_type to be set");
+        }
+    }
+
     return true;
 }
 
@@ -94,13 +105,22 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+static void printLatencyHistogram(const benchmark_app::LatencyHistogram& histogram) {
+    static const size_t maxBarLength = 50;
+    size_t maxCount = 1;
+    for (auto count : histogram.counts)
+        maxCount = std::max(maxCount, count);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < histogram.counts.size(); i++) {
+        ss << "    [" << std::setw(10) << histogram.lower_bound + histogram.bin_width * i << ", "
+           << std::setw(10) << histogram.lower_bound + histogram.bin_width * (i + 1)
+           << (i + 1 == histogram.counts.size() ? "] " : ") ")
+           << std::setw(8) << histogram.counts[i] << " "
+           << std::string(histogram.counts[i] * maxBarLength / maxCount, '#') << std::endl;
+    }
+    std::cout << "Latency histogram (ms):" << std::endl << ss.str();
 }
 
 /**
@@ -546,6 +566,38 @@ int main(int argc, char *argv[]) {
                                         {
                                                 {"first inference time (ms)", duration_ms}
                                         });
+
+        // the first inference is followed by optional warm-up iterations, both are excluded from the results
+        for (uint32_t i = 0; i < FLAGS_warmup; i++) {
+            inferRequest = inferRequestsQueue.getIdleRequest();
+            if (!inferRequest) {
+                IE_THROW() << "No idle Infer Requests!";
+            }
+            if (FLAGS_api == "sync") {
+                inferRequest->infer();
+            } else {
+                inferRequest->wait();
+                inferRequest->startAsync();
+            }
+        }
+        inferRequestsQueue.waitAll();
+        if (FLAGS_warmup > 0) {
+            auto warmupLatencies = inferRequestsQueue.getLatencies();
+            warmupLatencies.erase(warmupLatencies.begin());
+            auto warmupMetrics = getLatencyMetrics(warmupLatencies);
+            slog::info << "Warm-up: " << FLAGS_warmup << " iterations, median latency " << double_to_string(warmupMetrics.median)
+                       << " ms, max latency " << double_to_string(warmupMetrics.max) << " ms" << slog::endl;
+            if (statistics)
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"warm-up iterations", std::to_string(FLAGS_warmup)},
+                                                  {"warm-up median latency (ms)", double_to_string(warmupMetrics.median)},
+                                                  {"warm-up max latency (ms)", double_to_string(warmupMetrics.max)},
+                                          });
+        }
+        auto timeline = inferRequestsQueue.getTimeline();
+        for (auto& record : timeline)
+            record.warmup = true;
         inferRequestsQueue.resetTimes();
 
         auto startTime = Time::now();
@@ -594,7 +646,10 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        auto latencyMetrics = getLatencyMetrics(latencies);
+        auto latencyHistogram = getLatencyHistogram(latencies, FLAGS_latency_hist);
+        double latency = latencyMetrics.median;
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -609,7 +664,24 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
+                                                  {"min latency (ms)", double_to_string(latencyMetrics.min)},
+                                                  {"avg latency (ms)", double_to_string(latencyMetrics.avg)},
+                                                  {"p90 latency (ms)", double_to_string(latencyMetrics.p90)},
+                                                  {"p99 latency (ms)", double_to_string(latencyMetrics.p99)},
+                                                  {"p99.9 latency (ms)", double_to_string(latencyMetrics.p999)},
+                                                  {"max latency (ms)", double_to_string(latencyMetrics.max)},
                                           });
+                for (size_t i = 0; i < latencyHistogram.counts.size(); i++) {
+                    std::stringstream bin;
+                    bin << "latency histogram ["
+                        << double_to_string(latencyHistogram.lower_bound + latencyHistogram.bin_width * i) << ", "
+                        << double_to_string(latencyHistogram.lower_bound + latencyHistogram.bin_width * (i + 1))
+                        << (i + 1 == latencyHistogram.counts.size() ? "] ms" : ") ms");
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {bin.str(), std::to_string(latencyHistogram.counts[i])},
+                                              });
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -654,13 +726,28 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (statistics && !FLAGS_timeline.empty()) {
+            auto measurementTimeline = inferRequestsQueue.getTimeline();
+            timeline.insert(timeline.end(), measurementTimeline.begin(), measurementTimeline.end());
+            statistics->dumpTimeline(timeline, FLAGS_timeline);
+        }
+
         if (statistics)
             statistics->dump();
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "    Min:    " << double_to_string(latencyMetrics.min) << " ms" << std::endl;
+            std::cout << "    Avg:    " << double_to_string(latencyMetrics.avg) << " ms" << std::endl;
+            std::cout << "    P90:    " << double_to_string(latencyMetrics.p90) << " ms" << std::endl;
+            std::cout << "    P99:    " << double_to_string(latencyMetrics.p99) << " ms" << std::endl;
+            std::cout << "    P99.9:  " << double_to_string(latencyMetrics.p999) << " ms" << std::endl;
+            std::cout << "    Max:    " << double_to_string(latencyMetrics.max) << " ms" << std::endl;
+            if (!latencyHistogram.counts.empty())
+                printLatencyHistogram(latencyHistogram);
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -7,6 +7,7 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <fstream>
 
 #include "statistics_report.hpp"
 
@@ -132,3 +133,41 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpTimeline(const Timeline& timeline, const std::string& format) {
+    Timeline sortedTimeline(timeline);
+    std::stable_sort(sortedTimeline.begin(), sortedTimeline.end(), [] (const InferRecord& a, const InferRecord& b) {
+        return a.start_time < b.start_time;
+    });
+
+    std::string filename = _config.report_folder + _separator + "benchmark_timeline." + format;
+    if (format == csvTimeline) {
+        CsvDumper dumper(true, filename);
+        dumper << "phase" << "request id" << "start (ms)" << "end (ms)" << "latency (ms)";
+        dumper.endLine();
+        for (const auto& record : sortedTimeline) {
+            dumper << (record.warmup ? "warm-up" : "measurement") << record.request_id;
+            dumper << record.start_time << record.end_time << record.end_time - record.start_time;
+            dumper.endLine();
+        }
+    } else if (format == jsonTimeline) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            throw std::runtime_error("Can't open file " + filename + " to dump the timeline");
+        }
+        file << "[";
+        for (size_t i = 0; i < sortedTimeline.size(); i++) {
+            const auto& record = sortedTimeline[i];
+            file << (i == 0 ? "" : ",") << std::endl;
+            file << "  {\"phase\": \"" << (record.warmup ? "warm-up" : "measurement") << "\", "
+                 << "\"request_id\": " << record.request_id << ", "
+                 << "\"start_ms\": " << record.start_time << ", "
+                 << "\"end_ms\": " << record.end_time << ", "
+                 << "\"latency_ms\": " << record.end_time - record.start_time << "}";
+        }
+        file << std::endl << "]" << std::endl;
+    } else {
+        throw std::logic_error("Timeline can only be dumped in csv or json format");
+    }
+    slog::info << "Requests timeline is stored to " << filename << slog::endl;
+}
@@ -19,12 +19,25 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+// @brief timeline report formats
+static constexpr char csvTimeline[] = "csv";
+static constexpr char jsonTimeline[] = "json";
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
     typedef std::vector<std::pair<std::string, std::string>> Parameters;
 
+    /// @brief Execution record of a single inference, timestamps are in milliseconds
+    struct InferRecord {
+        size_t request_id;
+        double start_time;
+        double end_time;
+        bool warmup;
+    };
+    typedef std::vector<InferRecord> Timeline;
+
     struct Config {
         std::string report_type;
         std::string report_folder;
@@ -57,6 +70,8 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    void dumpTimeline(const Timeline& timeline, const std::string& format);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
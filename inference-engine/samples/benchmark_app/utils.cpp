@@ -9,6 +9,7 @@
 #include <map>
 #include <regex>
 #include <iostream>
+#include <numeric>
 
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
@@ -168,6 +169,48 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
     return ss.str();
 }
 
+benchmark_app::LatencyMetrics getLatencyMetrics(const std::vector<double>& latencies) {
+    benchmark_app::LatencyMetrics metrics;
+    if (latencies.empty())
+        return metrics;
+
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    // linear interpolation between the closest ranks, so the 50th percentile is the usual median
+    auto percentile = [&sorted] (double p) {
+        double position = p * (sorted.size() - 1);
+        size_t lower = static_cast<size_t>(position);
+        size_t upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - lower);
+    };
+
+    metrics.min = sorted.front();
+    metrics.max = sorted.back();
+    metrics.avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    metrics.median = percentile(0.5);
+    metrics.p90 = percentile(0.9);
+    metrics.p99 = percentile(0.99);
+    metrics.p999 = percentile(0.999);
+    return metrics;
+}
+
+benchmark_app::LatencyHistogram getLatencyHistogram(const std::vector<double>& latencies, size_t bins) {
+    benchmark_app::LatencyHistogram histogram;
+    if (latencies.empty() || bins == 0)
+        return histogram;
+
+    auto minmax = std::minmax_element(latencies.begin(), latencies.end());
+    histogram.lower_bound = *minmax.first;
+    histogram.bin_width = (*minmax.second - *minmax.first) / bins;
+    histogram.counts.resize(bins, 0);
+    for (auto latency : latencies) {
+        size_t bin = histogram.bin_width > 0.0 ? static_cast<size_t>((latency - histogram.lower_bound) / histogram.bin_width) : 0;
+        // the maximum value belongs to the last bin
+        histogram.counts[std::min(bin, bins - 1)]++;
+    }
+    return histogram;
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
                  const std::map<std::string, std::map<std::string, std::string>>& config) {
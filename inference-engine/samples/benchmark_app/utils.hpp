@@ -23,6 +23,22 @@ namespace benchmark_app {
         size_t depth() const;
     };
     using InputsInfo = std::map<std::string, InputInfo>;
+
+    struct LatencyMetrics {
+        double min = 0.0;
+        double avg = 0.0;
+        double median = 0.0;
+        double p90 = 0.0;
+        double p99 = 0.0;
+        double p999 = 0.0;
+        double max = 0.0;
+    };
+
+    struct LatencyHistogram {
+        double bin_width = 0.0;
+        double lower_bound = 0.0;
+        std::vector<size_t> counts;
+    };
 }
 
 std::vector<std::string> parseDevices(const std::string& device_string);
@@ -32,6 +48,8 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string &s, char delim);
+benchmark_app::LatencyMetrics getLatencyMetrics(const std::vector<double>& latencies);
+benchmark_app::LatencyHistogram getLatencyHistogram(const std::vector<double>& latencies, size_t bins);
 
 template <typename T>
 std::map<std::string, std::string> parseInputParameters(const std::string parameter_string,
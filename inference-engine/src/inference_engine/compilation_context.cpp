@@ -6,19 +6,26 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #ifndef WIN32
 #include <unistd.h>
 #endif
 #include <xml_parse_utils.h>
 
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "cpp_interfaces/exception2status.hpp"
-#include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -41,24 +48,221 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final: public std::streambuf {
-    std::size_t    m_res = {};
+/**
+ * Hashes memory by chunks in parallel. Every chunk is hashed by four independent lanes of 64-bit words,
+ * so the hash depends on the position of every word and runs at the memory bandwidth.
+ */
+static std::size_t hash_data(const void* data, std::size_t size) {
+    constexpr std::size_t chunkSize = 1 << 20;
+    const std::size_t chunksCount = (size + chunkSize - 1) / chunkSize;
+    std::vector<std::uint64_t> chunkHashes(chunksCount);
+    parallel_for(chunksCount, [&](std::size_t chunk) {
+        constexpr std::uint64_t prime = 0x100000001b3ULL;
+        std::uint64_t lanes[4] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL, 0x9e3779b97f4a7c15ULL, 0x7f4a7c159e3779b9ULL};
+        const auto begin = static_cast<const char*>(data) + chunk * chunkSize;
+        const std::size_t bytes = std::min(chunkSize, size - chunk * chunkSize);
+        const std::size_t words = bytes / sizeof(std::uint64_t);
+        std::size_t i = 0;
+        for (; i + 4 <= words; i += 4) {
+            for (std::size_t l = 0; l < 4; l++) {
+                std::uint64_t word;
+                std::memcpy(&word, begin + (i + l) * sizeof(word), sizeof(word));
+                lanes[l] = (lanes[l] ^ word) * prime;
+            }
+        }
+        for (std::size_t b = i * sizeof(std::uint64_t); b < bytes; b++)
+            lanes[b % 4] = (lanes[b % 4] ^ static_cast<unsigned char>(begin[b])) * prime;
+        chunkHashes[chunk] = lanes[0] ^ (lanes[1] << 1) ^ (lanes[2] << 2) ^ (lanes[3] << 3);
+    });
+
+    std::size_t seed = hash_combine(0, size);
+    for (auto chunkHash : chunkHashes)
+        seed = hash_combine(seed, chunkHash);
+    return seed;
+}
+
+/**
+ * Constants usually share buffers (e.g. the weights read from the same file or the network loaded to several
+ * devices), so the hashes of the buffers are kept while the buffers are alive.
+ * Contents of the buffers are assumed to be not changed after the first hash.
+ */
+static std::size_t hash_buffer(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    if (!buffer)
+        return 0;
+
+    struct CachedHash {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        std::size_t size;
+        std::size_t hash;
+    };
+    static std::mutex cacheMutex;
+    static std::unordered_map<const ngraph::runtime::AlignedBuffer*, CachedHash> cache;
+    // entries of the destroyed buffers are removed when the cache grows twice since the last sweep,
+    // so the sweeps take amortized constant time per inserted buffer
+    constexpr std::size_t minSweepSize = 64;
+    static std::size_t sweepSize = minSweepSize;
+
+    {
+        std::lock_guard<std::mutex> lock{cacheMutex};
+        auto found = cache.find(buffer.get());
+        // the address may be reused by another buffer after the cached one is destroyed
+        if (found != cache.end() && found->second.buffer.lock() == buffer && found->second.size == buffer->size())
+            return found->second.hash;
+    }
+
+    const auto hash = hash_data(buffer->get_ptr(), buffer->size());
+
+    std::lock_guard<std::mutex> lock{cacheMutex};
+    if (cache.size() >= sweepSize) {
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = it->second.buffer.expired() ? cache.erase(it) : std::next(it);
+        }
+        sweepSize = std::max(minSweepSize, 2 * cache.size());
+    }
+    cache[buffer.get()] = {buffer, buffer->size(), hash};
+    return hash;
+}
+
+/**
+ * Computes the hash of the function structure: types, attributes and output types of the operations and
+ * the connections between them. Constant values are hashed by hash_buffer.
+ */
+class ModelHashVisitor final : public ngraph::AttributeVisitor {
+    std::size_t m_seed = {};
+
+    template <typename T>
+    void hash_attribute(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hash_attribute(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
+
+    void hash_partial_shape(const ngraph::PartialShape& shape) {
+        m_seed = hash_combine(m_seed, shape.rank().is_static());
+        if (shape.rank().is_dynamic())
+            return;
+        for (const auto& dim : shape) {
+            m_seed = hash_combine(m_seed, dim.get_min_length());
+            m_seed = hash_combine(m_seed, dim.get_max_length());
+        }
+    }
+
 public:
-    std::size_t getResult() const { return m_res; }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t *)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+    std::size_t getResult() const { return m_seed; }
+
+    void hash_function(const ngraph::Function& function) {
+        std::unordered_map<const ngraph::Node*, std::size_t> nodeIds;
+        for (const auto& node : function.get_ordered_ops()) {
+            const std::size_t id = nodeIds.size();
+            nodeIds[node.get()] = id;
+
+            const auto& typeInfo = node->get_type_info();
+            m_seed = hash_combine(m_seed, std::string(typeInfo.name));
+            m_seed = hash_combine(m_seed, typeInfo.version);
+            m_seed = hash_combine(m_seed, node->get_friendly_name());
+
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                m_seed = hash_combine(m_seed, nodeIds.at(source.get_node()));
+                m_seed = hash_combine(m_seed, source.get_index());
+            }
+            for (const auto& output : node->outputs()) {
+                m_seed = hash_combine(m_seed, output.get_element_type().get_type_name());
+                hash_partial_shape(output.get_partial_shape());
+            }
+
+            node->visit_attributes(*this);
         }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+        for (const auto& parameter : function.get_parameters())
+            m_seed = hash_combine(m_seed, nodeIds.at(parameter.get()));
+        for (const auto& result : function.get_results())
+            m_seed = hash_combine(m_seed, nodeIds.at(result.get()));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, hash_buffer(a->get()));
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get()->get_info().variable_id);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                            <ngraph::op::util::SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(description->get_type_info().name));
+                m_seed = hash_combine(m_seed, description->m_input_index);
+                m_seed = hash_combine(m_seed, description->m_body_parameter_index);
+                if (auto slice = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(description)) {
+                    for (auto value : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, value);
+                } else if (auto merged = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(description)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                            <ngraph::op::util::SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(description->get_type_info().name));
+                m_seed = hash_combine(m_seed, description->m_body_value_index);
+                m_seed = hash_combine(m_seed, description->m_output_index);
+                if (auto concat = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(description)) {
+                    for (auto value : {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, value);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else {
+            // the value isn't accessible, the same as for IR serialization
+            m_seed = hash_combine(m_seed, std::string(adapter.get_type_info().name));
         }
-        return n;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, hash_data(adapter.get_ptr(), adapter.size()));
+    }
+
+#define ON_ADAPTER(type)                                                                           \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<type>& adapter) override {     \
+        hash_attribute(name, adapter.get());                                                        \
+    }
+    ON_ADAPTER(std::string)
+    ON_ADAPTER(bool)
+    ON_ADAPTER(int8_t)
+    ON_ADAPTER(int16_t)
+    ON_ADAPTER(int32_t)
+    ON_ADAPTER(int64_t)
+    ON_ADAPTER(uint8_t)
+    ON_ADAPTER(uint16_t)
+    ON_ADAPTER(uint32_t)
+    ON_ADAPTER(uint64_t)
+    ON_ADAPTER(float)
+    ON_ADAPTER(double)
+    ON_ADAPTER(std::vector<int8_t>)
+    ON_ADAPTER(std::vector<int16_t>)
+    ON_ADAPTER(std::vector<int32_t>)
+    ON_ADAPTER(std::vector<int64_t>)
+    ON_ADAPTER(std::vector<uint8_t>)
+    ON_ADAPTER(std::vector<uint16_t>)
+    ON_ADAPTER(std::vector<uint32_t>)
+    ON_ADAPTER(std::vector<uint64_t>)
+    ON_ADAPTER(std::vector<float>)
+    ON_ADAPTER(std::vector<double>)
+    ON_ADAPTER(std::vector<std::string>)
+#undef ON_ADAPTER
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        hash_function(*adapter.get());
     }
 };
 
@@ -87,29 +291,22 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
 
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
+    // 1. Compute hash on the function structure, constants and options.
+    // It is computed from the graph directly, since serialization of a big model costs more than its compilation
+    ModelHashVisitor modelHash;
+    modelHash.hash_function(*network.getFunction());
 
-    // 2. Compute hash on serialized data and options
     size_t seed {};
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    seed = hash_combine(seed, modelHash.getResult());
 
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
+    // 2. Add runtime information which may not be serialized
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
@@ -129,7 +326,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 4. Add inputs info
+    // 3. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -150,7 +347,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 5. Add outputs info
+    // 4. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
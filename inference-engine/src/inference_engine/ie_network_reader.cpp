@@ -9,6 +9,7 @@
 #include <file_utils.h>
 #include <ie_reader.hpp>
 #include <ie_ir_version.hpp>
+#include <ngraph/runtime/mmap_object.hpp>
 
 #include <fstream>
 #include <istream>
@@ -148,6 +149,42 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+/**
+ * @brief Allocator which provides memory of a mapped file and keeps the mapping alive
+ */
+class MmapAllocator final : public IAllocator {
+    std::shared_ptr<ngraph::runtime::MappedMemory> _memory;
+
+public:
+    explicit MmapAllocator(const std::shared_ptr<ngraph::runtime::MappedMemory>& memory) : _memory(memory) {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return size <= _memory->size() ? _memory->data() : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+};
+
+/**
+ * @brief Creates U8 blob on top of the mapped file
+ * @return nullptr for empty files, so the regular reading is used
+ */
+Blob::Ptr make_mmap_blob(const std::shared_ptr<ngraph::runtime::MappedMemory>& memory) {
+    if (!memory || memory->size() == 0 || memory->data() == nullptr)
+        return nullptr;
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, { memory->size() }, C }, std::make_shared<MmapAllocator>(memory));
+    blob->allocate();
+    return blob;
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -200,21 +237,32 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+                // Weights are mapped to memory, so pages are loaded only when they are accessed
+                // and are shared between processes which read the same model
+                Blob::Ptr weights;
+                try {
+                    weights = make_mmap_blob(ngraph::runtime::load_mmap_object(weights_path));
+                } catch (const std::exception&) {
+                    weights = nullptr;
+                }
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
+                if (!weights) {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened!";
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
 
-                binStream.read(weights->buffer(), fileSize);
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
 
-                binStream.close();
+                    binStream.read(weights->buffer(), fileSize);
+
+                    binStream.close();
+                }
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
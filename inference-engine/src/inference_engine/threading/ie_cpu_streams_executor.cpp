@@ -9,7 +9,10 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <climits>
 #include <cassert>
 #include <utility>
@@ -24,6 +27,12 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+// the executor and the index of the stream the current thread is dedicated to
+thread_local const void* workerExecutor = nullptr;
+thread_local int workerStreamId = 0;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -56,7 +65,11 @@ struct CPUStreamsExecutor::Impl {
 #endif
         explicit Stream(Impl* impl) :
             _impl(impl) {
-            {
+            if (workerExecutor == _impl) {
+                // stream threads keep their indices, so the task queue of a thread and its stream share a NUMA node
+                _streamId = workerStreamId;
+                _isWorker = true;
+            } else {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -123,7 +136,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -137,6 +150,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        bool _isWorker = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -145,6 +159,19 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief Task queue of a stream thread. Tasks are distributed between the queues in round robin order,
+     *        an idle stream thread steals tasks from other queues, the ones of the same NUMA node first.
+     */
+    struct TaskQueue {
+        struct Item {
+            Task                                    _task;
+            std::chrono::steady_clock::time_point   _enqueueTime;
+        };
+        std::mutex          _mutex;
+        std::deque<Item>    _items;
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -158,21 +185,37 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        // the same NUMA node distribution as for streams: consecutive stream threads share a node
+        const auto streamsPerNode = (_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size();
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue);
+            _streamNumaNodes.push_back(_usedNumaNodes.at(streamId / streamsPerNode));
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            std::vector<int> stealOrder;
+            for (auto offset = 0; offset < _config._streams; ++offset) {
+                auto victim = (streamId + offset) % _config._streams;
+                if (_streamNumaNodes[victim] == _streamNumaNodes[streamId])
+                    stealOrder.push_back(victim);
+            }
+            for (auto offset = 0; offset < _config._streams; ++offset) {
+                auto victim = (streamId + offset) % _config._streams;
+                if (_streamNumaNodes[victim] != _streamNumaNodes[streamId])
+                    stealOrder.push_back(victim);
+            }
+            _stealOrders.emplace_back(std::move(stealOrder));
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
+                workerExecutor = this;
+                workerStreamId = streamId;
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                    } else if (Wait()) {
+                        break;
                     }
                 }
             });
@@ -180,11 +223,78 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        Enqueue(std::move(task), _nextQueue.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size());
+    }
+
+    void Enqueue(Task task, int numaNodeId) {
+        std::vector<std::size_t> queues;
+        for (std::size_t i = 0; i < _streamNumaNodes.size(); ++i) {
+            if (_streamNumaNodes[i] == numaNodeId)
+                queues.push_back(i);
+        }
+        if (queues.empty()) {
+            Enqueue(std::move(task));
+        } else {
+            Enqueue(std::move(task), queues[_nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size()]);
+        }
+    }
+
+    void Enqueue(Task task, std::size_t queueIdx) {
+        auto& queue = *_taskQueues[queueIdx];
         {
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._items.push_back({std::move(task), std::chrono::steady_clock::now()});
+        }
+        _enqueuedTasks.fetch_add(1, std::memory_order_relaxed);
+        _pendingTasks.fetch_add(1);
+        // spinning and busy stream threads find the task without notification
+        if (_parkedThreads.load() > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool Pop(int streamId, Task& task) {
+        for (auto victim : _stealOrders[streamId]) {
+            auto& queue = *_taskQueues[victim];
+            TaskQueue::Item item;
+            {
+                std::lock_guard<std::mutex> lock(queue._mutex);
+                if (queue._items.empty())
+                    continue;
+                item = std::move(queue._items.front());
+                queue._items.pop_front();
+            }
+            _pendingTasks.fetch_sub(1);
+            if (victim != streamId)
+                _stolenTasks.fetch_add(1, std::memory_order_relaxed);
+            auto waitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - item._enqueueTime).count();
+            _queueWaitTime.fetch_add(static_cast<std::uint64_t>(waitTime), std::memory_order_relaxed);
+            _dequeuedTasks.fetch_add(1, std::memory_order_relaxed);
+            task = std::move(item._task);
+            return true;
         }
-        _queueCondVar.notify_one();
+        return false;
+    }
+
+    /**
+     * @brief Waits for new tasks: spins for configured number of iterations and then parks the thread
+     * @return true if the executor is stopped and all the tasks are executed
+     */
+    bool Wait() {
+        for (int i = 0; i < _config._spinCount; ++i) {
+            if (_pendingTasks.load(std::memory_order_relaxed) > 0)
+                return false;
+            if (_isStopped.load(std::memory_order_relaxed))
+                break;
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _parkedThreads.fetch_add(1);
+        _queueCondVar.wait(lock, [&] { return _pendingTasks.load() > 0 || _isStopped; });
+        _parkedThreads.fetch_sub(1);
+        return _pendingTasks.load() == 0 && _isStopped;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -220,10 +330,20 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::vector<int>                        _streamNumaNodes;
+    std::vector<std::vector<int>>           _stealOrders;
+    std::atomic<std::size_t>                _nextQueue{0};
+    std::atomic<std::int64_t>               _pendingTasks{0};
+    std::atomic<int>                        _parkedThreads{0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::atomic<bool>                       _isStopped{false};
+    std::chrono::steady_clock::time_point   _creationTime = std::chrono::steady_clock::now();
+    std::atomic<std::size_t>                _enqueuedTasks{0};
+    std::atomic<std::size_t>                _dequeuedTasks{0};
+    std::atomic<std::size_t>                _stolenTasks{0};
+    std::atomic<std::uint64_t>              _queueWaitTime{0};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
@@ -239,6 +359,31 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return stream->_numaNodeId;
 }
 
+std::vector<int> CPUStreamsExecutor::GetUsedNumaNodes() const {
+    return _impl->_usedNumaNodes;
+}
+
+void CPUStreamsExecutor::RunOnNumaNode(Task task, int numaNodeId) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), numaNodeId);
+    }
+}
+
+CPUStreamsExecutor::Statistics CPUStreamsExecutor::GetStatistics() const {
+    Statistics statistics;
+    statistics._tasks = _impl->_enqueuedTasks.load();
+    statistics._stolenTasks = _impl->_stolenTasks.load();
+    auto lifetime = std::chrono::duration<double>(std::chrono::steady_clock::now() - _impl->_creationTime).count();
+    if (lifetime > 0)
+        statistics._taskRate = statistics._tasks / lifetime;
+    auto dequeuedTasks = _impl->_dequeuedTasks.load();
+    if (dequeuedTasks > 0)
+        statistics._averageQueueWaitTime = _impl->_queueWaitTime.load() * 0.001 / dequeuedTasks;
+    return statistics;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
     _impl{new Impl{config}} {
 }
@@ -7,8 +7,10 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -105,6 +107,114 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES) snippets = true;
+            else if (val == PluginConfigParams::NO) snippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SNIPPETS
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::YES) weightsCompression = true;
+            else if (val == PluginConfigParams::NO) weightsCompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            shapeCacheSize = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            autoBatchSize = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non-negative integer numbers";
+            autoBatchTimeout = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_PREPROCESSING_STREAMS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PREPROCESSING_STREAMS
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PREPROCESSING_STREAMS
+                                   << ". Expected only non-negative integer numbers";
+            preprocessingStreams = val_i;
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_DISABLED) tuningMode = TuningMode::TuningDisabled;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING) tuningMode = TuningMode::TuningUseExisting;
+            else if (val == PluginConfigParams::TUNING_CREATE) tuningMode = TuningMode::TuningCreate;
+            else if (val == PluginConfigParams::TUNING_RETUNE) tuningMode = TuningMode::TuningRetune;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_DISABLED/TUNING_USE_EXISTING/TUNING_CREATE/TUNING_RETUNE";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
+        } else if (key == CPUConfigParams::KEY_CPU_STREAMS_SPIN_COUNT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_STREAMS_SPIN_COUNT
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_STREAMS_SPIN_COUNT
+                                   << ". Expected only non-negative integer numbers";
+            streamExecutorConfig._spinCount = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_SHAPE_BUCKETS) {
+            std::vector<size_t> buckets;
+            std::stringstream stream(val);
+            std::string bucket;
+            while (std::getline(stream, bucket, ',')) {
+                int val_i = -1;
+                try {
+                    val_i = std::stoi(bucket);
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                                       << ". Expected comma separated list of positive integer numbers";
+                }
+                if (val_i <= 0)
+                    IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHAPE_BUCKETS
+                                       << ". Expected comma separated list of positive integer numbers";
+                buckets.push_back(static_cast<size_t>(val_i));
+            }
+            std::sort(buckets.begin(), buckets.end());
+            buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+            shapeBuckets = buckets;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -141,9 +251,48 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (parallelBranches == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+
+        if (snippets == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_SNIPPETS, PluginConfigParams::NO });
+
+        if (weightsCompression == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, std::to_string(shapeCacheSize) });
+        std::string buckets;
+        for (auto bucket : shapeBuckets)
+            buckets += (buckets.empty() ? "" : ",") + std::to_string(bucket);
+        _config.insert({ CPUConfigParams::KEY_CPU_SHAPE_BUCKETS, buckets });
+        _config.insert({ CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE, std::to_string(autoBatchSize) });
+        _config.insert({ CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, std::to_string(autoBatchTimeout) });
+        _config.insert({ CPUConfigParams::KEY_CPU_PREPROCESSING_STREAMS, std::to_string(preprocessingStreams) });
+        switch (tuningMode) {
+            case TuningMode::TuningUseExisting:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_USE_EXISTING });
+                break;
+            case TuningMode::TuningCreate:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_CREATE });
+                break;
+            case TuningMode::TuningRetune:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_RETUNE });
+                break;
+            default:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_DISABLED });
+                break;
+        }
+        _config.insert({ PluginConfigParams::KEY_TUNING_FILE, tuningFile });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        _config.insert({ CPUConfigParams::KEY_CPU_STREAMS_SPIN_COUNT, std::to_string(streamExecutorConfig._spinCount) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <threading/ie_istreams_executor.hpp>
 
 namespace MKLDNNPlugin {
@@ -18,13 +19,31 @@ struct Config {
         On,
     };
 
+    enum TuningMode {
+        TuningDisabled,
+        TuningUseExisting,
+        TuningCreate,
+        TuningRetune,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    bool snippets = false;
+    bool weightsCompression = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int shapeCacheSize = 0;
+    std::vector<size_t> shapeBuckets;
+    int autoBatchSize = 0;
+    // microseconds
+    int autoBatchTimeout = 1000;
+    int preprocessingStreams = 0;
+    TuningMode tuningMode = TuningMode::TuningDisabled;
+    std::string tuningFile = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
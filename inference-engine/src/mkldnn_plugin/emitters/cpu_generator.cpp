@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+#include "jit_snippets_emitters.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/vector_to_scalar.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace mkldnn::impl::cpu::x64;
+
+namespace MKLDNNPlugin {
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) -> std::shared_ptr<ngraph::snippets::Emitter> { \
+    return std::make_shared<e_type>(h.get(), isa, n); \
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : h(new jit_snippet()), isa(isa) {
+    // data movement
+    jitters[ngraph::opset1::Parameter::type_info] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::snippets::op::BlockedParameter::type_info] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::opset1::Result::type_info] = CREATE_EMITTER(NopEmitter);
+    jitters[ngraph::snippets::op::Nop::type_info] = CREATE_EMITTER(NopEmitter);
+
+    jitters[ngraph::snippets::op::Load::type_info] = CREATE_EMITTER(LoadEmitter);
+    jitters[ngraph::snippets::op::ScalarLoad::type_info] = CREATE_EMITTER(ScalarLoadEmitter);
+    jitters[ngraph::snippets::op::BroadcastLoad::type_info] = CREATE_EMITTER(BroadcastLoadEmitter);
+    jitters[ngraph::snippets::op::Store::type_info] = CREATE_EMITTER(StoreEmitter);
+    jitters[ngraph::snippets::op::ScalarStore::type_info] = CREATE_EMITTER(ScalarStoreEmitter);
+    jitters[ngraph::snippets::op::Scalar::type_info] = CREATE_EMITTER(ScalarEmitter);
+    jitters[ngraph::snippets::op::BroadcastMove::type_info] = CREATE_EMITTER(FakeBroadcastEmitter);
+
+    // binary
+    jitters[ngraph::opset1::Add::type_info] = CREATE_EMITTER(jit_add_emitter);
+    jitters[ngraph::opset1::Divide::type_info] = CREATE_EMITTER(jit_divide_emitter);
+    jitters[ngraph::opset1::Equal::type_info] = CREATE_EMITTER(jit_equal_emitter);
+    jitters[ngraph::opset1::FloorMod::type_info] = CREATE_EMITTER(jit_floor_mod_emitter);
+    jitters[ngraph::opset1::Greater::type_info] = CREATE_EMITTER(jit_greater_emitter);
+    jitters[ngraph::opset1::GreaterEqual::type_info] = CREATE_EMITTER(jit_greater_equal_emitter);
+    jitters[ngraph::opset1::Less::type_info] = CREATE_EMITTER(jit_less_emitter);
+    jitters[ngraph::opset1::LessEqual::type_info] = CREATE_EMITTER(jit_less_equal_emitter);
+    jitters[ngraph::opset1::LogicalAnd::type_info] = CREATE_EMITTER(jit_logical_and_emitter);
+    jitters[ngraph::opset1::LogicalOr::type_info] = CREATE_EMITTER(jit_logical_or_emitter);
+    jitters[ngraph::opset1::LogicalXor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::opset1::Maximum::type_info] = CREATE_EMITTER(jit_maximum_emitter);
+    jitters[ngraph::opset1::Minimum::type_info] = CREATE_EMITTER(jit_minimum_emitter);
+    jitters[ngraph::opset1::Mod::type_info] = CREATE_EMITTER(jit_mod_emitter);
+    jitters[ngraph::opset1::Multiply::type_info] = CREATE_EMITTER(jit_multiply_emitter);
+    jitters[ngraph::opset1::NotEqual::type_info] = CREATE_EMITTER(jit_not_equal_emitter);
+    jitters[ngraph::snippets::op::PowerStatic::type_info] = CREATE_EMITTER(jit_power_static_emitter);
+    jitters[ngraph::opset1::Power::type_info] = CREATE_EMITTER(jit_power_dynamic_emitter);
+    jitters[ngraph::opset1::PRelu::type_info] = CREATE_EMITTER(jit_prelu_emitter);
+    jitters[ngraph::opset1::SquaredDifference::type_info] = CREATE_EMITTER(jit_squared_difference_emitter);
+    jitters[ngraph::opset1::Subtract::type_info] = CREATE_EMITTER(jit_subtract_emitter);
+    jitters[ngraph::opset1::Xor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+
+    // unary
+    jitters[ngraph::opset1::Abs::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Clamp::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Elu::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Exp::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::LogicalNot::type_info] = CREATE_EMITTER(jit_logical_not_emitter);
+    jitters[ngraph::opset1::Negative::type_info] = CREATE_EMITTER(jit_negative_emitter);
+    jitters[ngraph::opset1::Relu::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Sigmoid::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Sqrt::type_info] = CREATE_EMITTER(jit_sqrt_emitter);
+    jitters[ngraph::opset1::Tanh::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+}
+
+bool CPUGenerator::isSupported(const std::shared_ptr<ngraph::Function>& f) const {
+    for (const auto& op : f->get_ops()) {
+        // constants are converted to scalars during canonicalization
+        if (ngraph::is_type<ngraph::opset1::Constant>(op))
+            continue;
+        if (jitters.find(op->get_type_info()) == jitters.end())
+            return false;
+    }
+    return true;
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    auto lower = [this](const std::shared_ptr<ngraph::Function>& body) {
+        std::vector<EmitterCode> code;
+        for (auto n : body->get_ordered_ops()) {
+            auto jitter = jitters.find(n->get_type_info());
+            if (jitter == jitters.end())
+                IE_THROW() << "Snippet operation " << n->get_type_name() << " is not supported by CPU generator";
+            code.emplace_back(jitter->second(n), ngraph::snippets::getRegisters(n));
+        }
+        return code;
+    };
+
+    const size_t vectorSize = isa == avx512_common ? 16 : isa == avx2 ? 8 : 4;
+    auto vectorTile = std::make_shared<TileEmitter>(h.get(), isa, lower(f), vectorSize);
+
+    // the tail is processed element by element
+    auto scalarBody = ngraph::clone_function(*f);
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    manager.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.run_passes(scalarBody);
+    auto scalarTile = std::make_shared<TileEmitter>(h.get(), isa, lower(scalarBody), 1);
+
+    std::vector<EmitterCode> tiles = {
+        {vectorTile, ngraph::snippets::RegInfo{}},
+        {scalarTile, ngraph::snippets::RegInfo{}},
+    };
+    KernelEmitter kernel(h.get(), isa, tiles, f->get_parameters().size() + f->get_results().size());
+
+    // the vector registers which aren't assigned to the snippet operations are free for the auxiliary needs of the emitters
+    std::set<size_t> usedVecs;
+    for (const auto& body : {f, scalarBody}) {
+        for (auto n : body->get_ordered_ops()) {
+            const auto regs = ngraph::snippets::getRegisters(n).second;
+            usedVecs.insert(regs.begin(), regs.end());
+        }
+    }
+    const size_t vecsCount = isa == avx512_common ? 32 : 16;
+    std::vector<size_t> vecPool;
+    for (size_t i = 0; i < vecsCount; i++) {
+        if (usedVecs.count(i) == 0)
+            vecPool.push_back(i);
+    }
+    const std::vector<size_t> gprPool = {
+        static_cast<size_t>(Xbyak::Operand::RAX), static_cast<size_t>(Xbyak::Operand::RBX),
+        static_cast<size_t>(Xbyak::Operand::RBP), static_cast<size_t>(Xbyak::Operand::RSI)
+    };
+
+    kernel.emit_code({}, {}, vecPool, gprPool);
+    kernel.emit_data();
+
+    h->create_kernel();
+    return h->jit_ker();
+}
+
+} // namespace MKLDNNPlugin
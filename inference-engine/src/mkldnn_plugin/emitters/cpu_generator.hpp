@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include <snippets/generator.hpp>
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+    ~jit_snippet() override = default;
+
+    // the code is emitted by the snippet emitters
+    void generate() override {}
+};
+
+/**
+ * @brief Generates a kernel for a snippet body lowered to the snippets dialect. The kernel processes
+ * jit_snippets_call_args::work_amount elements along the innermost dimension: a vector tile is executed
+ * while a whole vector of elements is left, a scalar tile processes the tail.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() override = default;
+
+    bool isSupported(const std::shared_ptr<ngraph::Function>& f) const;
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+} // namespace MKLDNNPlugin
@@ -47,6 +47,8 @@ class jit_mkldnn_aux_emitter : public jit_mkldnn_emitter {
 public:
     jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const MKLDNNNode* node,
                            InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+    jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                           InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
 
 private:
 };
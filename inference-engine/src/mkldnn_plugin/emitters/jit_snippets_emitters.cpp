@@ -0,0 +1,290 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/variant.hpp>
+#include <snippets/snippets_isa.hpp>
+
+#include <cstddef>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// First general purpose register used for snippet arguments by the register assignment pass
+constexpr int reg64_args_start = 8;
+
+// A load doesn't advance along the innermost dimension if it's broadcasted to the snippet outputs.
+// All the snippet operations are elementwise, so any path from the load reaches a result of the output shape.
+bool is_innermost_broadcast(const std::shared_ptr<ngraph::Node>& load) {
+    auto n = load;
+    while (!ngraph::is_type<ngraph::opset1::Result>(n)) {
+        n = n->output(0).get_target_inputs().begin()->get_node()->shared_from_this();
+    }
+
+    const auto& in_shape = load->get_input_shape(0);
+    const auto& out_shape = n->get_input_shape(0);
+    return !in_shape.empty() && !out_shape.empty() && in_shape.back() != out_shape.back();
+}
+
+} // namespace
+
+const Reg64 jit_snippets_emitter::reg_work_amount = Reg64(Operand::RDX);
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* host, cpu_isa_t host_isa, std::vector<EmitterCode> tiles, size_t num_args)
+    : jit_snippets_emitter(host, host_isa, nullptr), tiles(std::move(tiles)), num_args(num_args) {
+    if (num_args > SNIPPETS_MAX_ARGS)
+        IE_THROW() << "Snippet has " << num_args << " arguments while no more than " << SNIPPETS_MAX_ARGS << " are supported";
+}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                              const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const {
+    h->preamble();
+
+    for (size_t i = 0; i < num_args; i++) {
+        h->mov(Reg64(reg64_args_start + static_cast<int>(i)), h->ptr[abi_param1 + GET_OFF(ptrs) + i * sizeof(void*)]);
+    }
+    h->mov(reg_work_amount, h->ptr[abi_param1 + GET_OFF(work_amount)]);
+
+    for (const auto& tile : tiles) {
+        tile.first->emit_code(tile.second.first, tile.second.second, pool_vec_idxs, pool_gpr_idxs);
+    }
+
+    h->postamble();
+}
+
+void KernelEmitter::emit_data() const {
+    for (const auto& tile : tiles) {
+        tile.first->emit_data();
+    }
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* host, cpu_isa_t host_isa, std::vector<EmitterCode> body, size_t increment)
+    : jit_snippets_emitter(host, host_isa, nullptr), body(std::move(body)), increment(increment) {}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const {
+    Label for_body;
+    Label for_end;
+
+    h->L(for_body);
+    {
+        h->cmp(reg_work_amount, increment);
+        h->jl(for_end, jit_generator::T_NEAR);
+
+        for (const auto& code : body) {
+            code.first->emit_code(code.second.first, code.second.second, pool_vec_idxs, pool_gpr_idxs);
+        }
+
+        h->sub(reg_work_amount, increment);
+        h->jmp(for_body, jit_generator::T_NEAR);
+    }
+    h->L(for_end);
+}
+
+void TileEmitter::emit_data() const {
+    for (const auto& code : body) {
+        code.first->emit_data();
+    }
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_snippets_emitter(host, host_isa, n) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "Cannot create scalar emitter for " << n->get_friendly_name();
+
+    push_arg_entry_of("scalar", float2int(scalar->cast_vector<float>()[0]), true);
+    prepare_table();
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                              const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                              const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// BROADCAST MOVE ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_snippets_emitter(host, host_isa, n) {
+    const auto& in_shape = n->get_input_shape(0);
+    const auto& out_shape = n->get_output_shape(0);
+    use_broadcast = !in_shape.empty() && in_shape.back() != out_shape.back();
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                     const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in_idxs[0]);
+    Vmm vmm_dst  = Vmm(out_idxs[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in_idxs[0]));
+    } else if (vmm_dst.getIdx() != vmm_src0.getIdx()) {
+        h->uni_vmovups(vmm_dst, vmm_src0);
+    }
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_snippets_emitter(host, host_isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Snippet memory operation " << n->get_friendly_name() << " doesn't have an effective address";
+
+    ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get();
+}
+
+/// LOAD ///
+LoadEmitter::LoadEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(host, host_isa, n), shouldPostIncrement(!is_innermost_broadcast(n)) {}
+
+void LoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                            const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (shouldPostIncrement) {
+        h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+        h->add(in_reg, get_vec_length());
+    } else {
+        // the same element is used for the whole vector, reading a full vector may cross the buffer end
+        h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+    }
+}
+
+/// BROADCAST LOAD ///
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                     const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+/// SCALAR LOAD ///
+ScalarLoadEmitter::ScalarLoadEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(host, host_isa, n), shouldPostIncrement(!is_innermost_broadcast(n)) {}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                  const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                  const emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+    Xmm xmm_dst = Xmm(out_idxs[0]);
+
+    h->uni_vmovss(xmm_dst, h->ptr[in_reg]);
+    if (shouldPostIncrement)
+        h->add(in_reg, sizeof(float));
+}
+
+/// STORE ///
+void StoreEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                             const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                             const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    Vmm vmm_src0 = Vmm(in_idxs[0]);
+
+    h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+    h->add(out_reg, get_vec_length());
+}
+
+/// SCALAR STORE ///
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+    Xmm xmm_src0 = Xmm(in_idxs[0]);
+
+    h->uni_vmovss(h->ptr[out_reg], xmm_src0);
+    h->add(out_reg, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,209 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include <snippets/generator.hpp>
+#include "jit_emitter.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+// Snippet arguments are kept in R8..R15 by the register assignment pass, so no more than 8 inputs and outputs are allowed
+#define SNIPPETS_MAX_ARGS 8
+
+struct jit_snippets_call_args {
+    // inputs followed by outputs in the order of snippet body parameters and results
+    const void* ptrs[SNIPPETS_MAX_ARGS];
+    // number of elements to process along the innermost dimension
+    size_t work_amount;
+};
+
+using EmitterCode = std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>;
+
+class jit_snippets_emitter : public jit_emitter {
+public:
+    jit_snippets_emitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                         const std::shared_ptr<ngraph::Node>& n,
+                         emitter_in_out_map in_out_type = emitter_in_out_map::vec_to_vec)
+        : jit_emitter(host, host_isa, n, InferenceEngine::Precision::FP32, in_out_type) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+protected:
+    static const Xbyak::Reg64 reg_work_amount;
+};
+
+/// KERNEL ///
+// Loads the call arguments, executes the tiles and returns to the caller
+class KernelEmitter : public jit_snippets_emitter {
+public:
+    KernelEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                  std::vector<EmitterCode> tiles, size_t num_args);
+
+    void emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const override;
+    void emit_data() const override;
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+
+    std::vector<EmitterCode> tiles;
+    size_t num_args;
+};
+
+/// TILE ///
+// Executes the body while at least 'increment' elements are left to process
+class TileEmitter : public jit_snippets_emitter {
+public:
+    TileEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                std::vector<EmitterCode> body, size_t increment);
+
+    void emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const override;
+    void emit_data() const override;
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+
+    std::vector<EmitterCode> body;
+    size_t increment;
+};
+
+/// NOP ///
+class NopEmitter : public jit_snippets_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_snippets_emitter(host, host_isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+};
+
+/// SCALAR ///
+// Broadcasts a scalar constant to the whole vector register
+class ScalarEmitter : public jit_snippets_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+};
+
+/// BROADCAST MOVE ///
+// Broadcasts the first element of the register if the innermost dimension is broadcasted, copies the register otherwise
+class FakeBroadcastEmitter : public jit_snippets_emitter {
+public:
+    FakeBroadcastEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+
+    bool use_broadcast;
+};
+
+/// MEMORY ///
+class MemoryEmitter : public jit_snippets_emitter {
+public:
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+protected:
+    // index of the general purpose register which holds the pointer to the argument
+    int64_t ea;
+};
+
+class LoadEmitter : public MemoryEmitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+
+    // the same element is reused on each iteration if the innermost dimension is broadcasted
+    bool shouldPostIncrement;
+};
+
+class BroadcastLoadEmitter : public MemoryEmitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(host, host_isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+};
+
+class ScalarLoadEmitter : public MemoryEmitter {
+public:
+    ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    bool shouldPostIncrement;
+};
+
+class StoreEmitter : public MemoryEmitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(host, host_isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs) const;
+};
+
+class ScalarStoreEmitter : public MemoryEmitter {
+public:
+    ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(host, host_isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+};
+
+} // namespace MKLDNNPlugin
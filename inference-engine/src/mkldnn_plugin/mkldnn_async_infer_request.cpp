@@ -3,13 +3,78 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_requests_batcher.h"
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <memory>
+#include <utility>
+
+namespace {
+/**
+ * Runs tasks on the streams of the NUMA node the request blobs are placed on
+ */
+class NumaNodeTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    NumaNodeTaskExecutor(const std::shared_ptr<InferenceEngine::CPUStreamsExecutor>& executor, int numaNodeId)
+        : _executor(executor), _numaNodeId(numaNodeId) {}
+
+    void run(InferenceEngine::Task task) override {
+        _executor->RunOnNumaNode(std::move(task), _numaNodeId);
+    }
+
+private:
+    std::shared_ptr<InferenceEngine::CPUStreamsExecutor> _executor;
+    int _numaNodeId;
+};
+
+/**
+ * Holds tasks of the request in the batcher, so they are run after the batch the request is added to is inferred.
+ * Tasks of the requests which can't be batched are run by the request executor
+ */
+class BatchingTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    BatchingTaskExecutor(const MKLDNNPlugin::MKLDNNRequestsBatcher::Ptr& batcher, MKLDNNPlugin::MKLDNNInferRequest* request,
+                         const InferenceEngine::ITaskExecutor::Ptr& executor)
+        : _batcher(batcher), _request(request), _executor(executor) {}
+
+    void run(InferenceEngine::Task task) override {
+        if (!_batcher->Enqueue(_request, task))
+            _executor->run(std::move(task));
+    }
+
+private:
+    MKLDNNPlugin::MKLDNNRequestsBatcher::Ptr _batcher;
+    MKLDNNPlugin::MKLDNNInferRequest* _request;
+    InferenceEngine::ITaskExecutor::Ptr _executor;
+};
+}  // namespace
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto mkldnnRequest = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    mkldnnRequest->SetAsyncRequest(this);
+
+    InferenceEngine::ITaskExecutor::Ptr requestExecutor = taskExecutor;
+    auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(taskExecutor);
+    if (streamsExecutor && streamsExecutor->GetUsedNumaNodes().size() > 1 && mkldnnRequest->GetNumaNodeId() >= 0) {
+        requestExecutor = std::make_shared<NumaNodeTaskExecutor>(streamsExecutor, mkldnnRequest->GetNumaNodeId());
+        _pipeline = {{requestExecutor, [mkldnnRequest] {mkldnnRequest->InferImpl();}}};
+    }
+
+    // Synchronous inference is coalesced as well, since the requests are usually inferred from many threads then
+    if (auto batcher = mkldnnRequest->GetRequestsBatcher()) {
+        _pipeline = {{std::make_shared<BatchingTaskExecutor>(batcher, mkldnnRequest, requestExecutor),
+                      [mkldnnRequest] {mkldnnRequest->InferOrTakeBatchResult();}}};
+        _syncPipeline = _pipeline;
+    }
+
+    // Pre-processing of the request overlaps with the inference of the previous ones on the stream
+    if (auto preprocessingExecutor = mkldnnRequest->GetPreprocessingExecutor()) {
+        _pipeline.insert(_pipeline.begin(), {preprocessingExecutor, [mkldnnRequest] {mkldnnRequest->PreprocessInputs();}});
+        _syncPipeline.insert(_syncPipeline.begin(), {std::make_shared<InferenceEngine::ImmediateExecutor>(),
+                                                     [mkldnnRequest] {mkldnnRequest->PreprocessInputs();}});
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -145,7 +145,7 @@ int MKLDNNEdge::getOutputNum() {
     return child_port;
 }
 
-void MKLDNNEdge::allocate(const void* mem_ptr) {
+void MKLDNNEdge::allocate(const void* mem_ptr, int numaNodeId) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -164,7 +164,10 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
 
     auto parentPtr = getParent();
     memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
-    memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
+    if (mem_ptr == nullptr && numaNodeId >= 0)
+        memoryPtr->CreateOnNumaNode(MKLDNNMemoryDesc(inputDesc), numaNodeId);
+    else
+        memoryPtr->Create(MKLDNNMemoryDesc(inputDesc), mem_ptr, false);  // no pads zeroing
     status = Status::Allocated;
 }
 
@@ -198,8 +201,9 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
         return;
 
     if (weightsCache) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, &weightsCache] () {
+            // the constants are kept in a separate mapping bound to the node of the streams sharing them
+            allocate(nullptr, weightsCache->GetNumaNodeId());
             return memoryPtr;
         };
 
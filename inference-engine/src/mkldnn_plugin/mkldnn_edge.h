@@ -45,7 +45,7 @@ public:
     void changeStatus(Status state);
 
     void init();
-    void allocate(const void* mem_ptr = nullptr);
+    void allocate(const void* mem_ptr = nullptr, int numaNodeId = -1);
     void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
     void validate();
     void drop();
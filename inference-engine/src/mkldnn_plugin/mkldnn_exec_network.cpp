@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -11,6 +12,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
@@ -20,15 +22,78 @@
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
+#include <map>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <blob_factory.hpp>
+#include <ie_parallel.hpp>
+#include <chrono>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+bool isSameConstant(const Blob::Ptr& lhs, const Blob::Ptr& rhs) {
+    if (lhs == nullptr || rhs == nullptr)
+        return lhs == rhs;
+    if (lhs->getTensorDesc() != rhs->getTensorDesc() || lhs->byteSize() != rhs->byteSize())
+        return false;
+    auto lhsData = lhs->cbuffer().as<const uint8_t*>();
+    auto rhsData = rhs->cbuffer().as<const uint8_t*>();
+    return lhsData == rhsData || std::memcmp(lhsData, rhsData, lhs->byteSize()) == 0;
+}
+
+/**
+ * Constants are shared between graphs by the layer names, so constants calculated from input shapes (e.g. reshape
+ * patterns) and everything computed from them are renamed to avoid taking the values from the other graphs
+ */
+void renameShapeDependentConstants(CNNNetwork& network, const CNNNetwork& originalNetwork, const std::string& suffix) {
+    auto isConst = [](const CNNLayerPtr& layer) {
+        return CaselessEq<std::string>()(layer->type, "const");
+    };
+    auto getConstBlob = [](const CNNLayerPtr& layer) {
+        return layer->blobs.empty() ? nullptr : layer->blobs.begin()->second;
+    };
+
+    std::unordered_map<std::string, Blob::Ptr> originalConstants;
+    for (auto& layer : CNNNetSortTopologically(originalNetwork)) {
+        if (isConst(layer))
+            originalConstants[layer->name] = getConstBlob(layer);
+    }
+
+    std::unordered_set<CNNLayer*> constantLayers, shapeDependentLayers;
+    for (auto& layer : CNNNetSortTopologically(network)) {
+        if (isConst(layer)) {
+            constantLayers.insert(layer.get());
+            auto original = originalConstants.find(layer->name);
+            if (original == originalConstants.end() || !isSameConstant(original->second, getConstBlob(layer)))
+                shapeDependentLayers.insert(layer.get());
+        } else if (!layer->insData.empty()) {
+            bool allInputsConstant = true;
+            bool anyInputShapeDependent = false;
+            for (auto& data : layer->insData) {
+                auto parent = getCreatorLayer(data.lock()).lock();
+                allInputsConstant = allInputsConstant && parent && constantLayers.count(parent.get());
+                anyInputShapeDependent = anyInputShapeDependent || (parent && shapeDependentLayers.count(parent.get()));
+            }
+            if (allInputsConstant) {
+                constantLayers.insert(layer.get());
+                if (anyInputShapeDependent)
+                    shapeDependentLayers.insert(layer.get());
+            }
+        }
+    }
+
+    for (auto layer : shapeDependentLayers)
+        layer->name += suffix;
+}
+
+}  // namespace
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -38,17 +103,117 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const ExportedFunctionProvider &exportedFunctionProvider,
+                                     const NetworkReshaper &networkReshaper) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights) {
+    _numaNodesWeights(numaNodesWeights),
+    _exportedFunctionProvider(exportedFunctionProvider),
+    _networkReshaper((cfg.shapeCacheSize > 0 || cfg.autoBatchSize > 1) && cfg.batchLimit == 0 ? networkReshaper : nullptr),
+    _isShapeCacheEnabled(_networkReshaper && cfg.shapeCacheSize > 0) {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
 
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNetwork(network);
 
+    OV_ITT_TASK_NEXT(taskChain, "prepareNetwork");
+    PrepareNetwork(_clonedNetwork);
+
+    OV_ITT_TASK_SKIP(taskChain);
+
+    if (_cfg.batchLimit > 1) {
+        // check topology for applicability
+        if (!CanProcessDynBatch(_clonedNetwork)) {
+            IE_THROW() << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        }
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+    if (_cfg.preprocessingStreams > 0) {
+        _preprocessingExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreprocessingExecutor", _cfg.preprocessingStreams, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
+    if (_cfg.tuningMode != Config::TuningMode::TuningDisabled) {
+        _tuningCache = std::make_shared<MKLDNNTuningCache>(_cfg.tuningFile);
+        if (_cfg.tuningMode == Config::TuningMode::TuningCreate || _cfg.tuningMode == Config::TuningMode::TuningRetune) {
+            // the graphs are measured on a thread of a stream as they will be used
+            if (_cfg.streamExecutorConfig._streams != 0) {
+                std::vector<Task> tuningTasks{[this] {TuneGraph();}};
+                _taskExecutor->runAndWait(tuningTasks);
+            } else {
+                TuneGraph();
+            }
+        }
+    }
+
+    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    std::vector<Task> tasks; tasks.resize(streams);
+    _graphs.resize(streams);
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        for (auto&& task : tasks) {
+            task = [this] {
+                MKLDNNExecNetwork::GetGraph();
+            };
+        }
+        _taskExecutor->runAndWait(tasks);
+    } else {
+        MKLDNNExecNetwork::GetGraph();
+    }
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : GetGraph()._graph.GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = memoryNode->getId();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            }
+        }
+    }
+
+    if (_cfg.autoBatchSize > 1 && _networkReshaper && CanBatchRequests()) {
+        _requestsBatcher = std::make_shared<MKLDNNRequestsBatcher>(_taskExecutor, static_cast<size_t>(_cfg.autoBatchSize),
+            std::chrono::microseconds(_cfg.autoBatchTimeout),
+            [this] (const std::vector<MKLDNNInferRequest*>& requests) {
+                return InferBatch(requests);
+            });
+        CreateBatchedGraphs();
+    }
+}
+
+void MKLDNNExecNetwork::PrepareNetwork(InferenceEngine::CNNNetwork& network) const {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::PrepareNetwork");
+
+    // the plugin keeps ngraph representation of the network only if the legacy preparations aren't needed
+    if (network.getFunction())
+        return;
+
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
@@ -64,9 +229,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
 
         auto changePrecisionBF16 = [&](Precision current, Precision target) {
-            InputsDataMap inputs = _clonedNetwork.getInputsInfo();
-            OutputsDataMap outputs = _clonedNetwork.getOutputsInfo();
-            CNNNetworkIterator iter(_clonedNetwork);
+            InputsDataMap inputs = network.getInputsInfo();
+            OutputsDataMap outputs = network.getOutputsInfo();
+            CNNNetworkIterator iter(network);
             while (iter != CNNNetworkIterator()) {
                 //  check, if memory output node needs to be transformed
                 if (current == Precision::FP32 &&
@@ -89,16 +254,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-            // Otherwise, only layers marked as BF16 in '_clonedNetwork' will be performed in bfloat16 mode.
+            // Otherwise, only layers marked as BF16 in 'network' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (_cfg.enforceBF16 == true)
                 changePrecisionBF16(Precision::FP32, Precision::BF16);
         } else {
             changePrecisionBF16(Precision::BF16, Precision::FP32);
         }
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, const std::vector<size_t>& shape, const std::string& name) {
         LayerParams attrs = {layer->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
         auto constLayer = std::make_shared<InferenceEngine::CNNLayer>(attrs);
@@ -112,7 +276,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         getInputTo(newEdgeAfterLayer).clear();
 
         IE_SUPPRESS_DEPRECATED_START
-        auto icnnnet = static_cast<ICNNNetwork::Ptr>(_clonedNetwork);
+        auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
         IE_SUPPRESS_DEPRECATED_END
         auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
         IE_ASSERT(implNetwork != nullptr);
@@ -126,7 +290,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     // The code block below transforms legacy layers to the form more compatible with opset1 in order to simplify future migration
     // TODO: remove after plug-in is migrated on opset1
-    auto all_layers = details::CNNNetSortTopologically(_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             auto constDimsRank = layer->insData[0].lock()->getDims().size();
@@ -215,64 +379,6 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
-
-    OV_ITT_TASK_SKIP(taskChain);
-
-    if (_cfg.batchLimit > 1) {
-        // check topology for applicability
-        if (!CanProcessDynBatch(_clonedNetwork)) {
-            IE_THROW() << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
-        }
-    }
-
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-    }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
-    }
-
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
-        for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
-        }
-        _taskExecutor->runAndWait(tasks);
-    } else {
-        MKLDNNExecNetwork::GetGraph();
-    }
-
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
-        }
-    }
 }
 
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
@@ -293,6 +399,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.tuningCache = _tuningCache;
                 graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -310,6 +417,385 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+size_t MKLDNNExecNetwork::GetShapeCacheSize() {
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    return static_cast<size_t>(std::max(_cfg.shapeCacheSize, 1));
+}
+
+InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetSpecializedNetwork(const InputShapes& inputShapes) {
+    if (!IsShapeCacheEnabled())
+        IE_THROW() << "Input shapes differ from the network ones, but the shape cache is disabled";
+
+    std::promise<CNNNetwork> promise;
+    std::shared_future<CNNNetwork> network;
+    bool isCreator = false;
+    {
+        std::lock_guard<std::mutex> lock{_specializedNetworksMutex};
+        auto& networks = _specializedNetworks;
+        auto found = std::find_if(networks.begin(), networks.end(),
+            [&](const std::pair<InputShapes, std::shared_future<CNNNetwork>>& item) {
+                return item.first == inputShapes;
+            });
+        if (found != networks.end()) {
+            networks.splice(networks.begin(), networks, found);
+        } else {
+            const size_t cacheSize = GetShapeCacheSize();
+            while (networks.size() >= cacheSize)
+                networks.pop_back();
+            networks.emplace_front(inputShapes, promise.get_future().share());
+            isCreator = true;
+        }
+        network = networks.front().second;
+    }
+
+    if (isCreator) {
+        try {
+            promise.set_value(CreateSpecializedNetwork(inputShapes));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            // the failed shapes aren't cached, so the error is reported by the next attempt as well
+            std::lock_guard<std::mutex> lock{_specializedNetworksMutex};
+            _specializedNetworks.remove_if([&](const std::pair<InputShapes, std::shared_future<CNNNetwork>>& item) {
+                return item.first == inputShapes;
+            });
+        }
+    }
+    return network.get();
+}
+
+InferenceEngine::CNNNetwork MKLDNNExecNetwork::CreateSpecializedNetwork(const InputShapes& inputShapes) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::CreateSpecializedNetwork");
+
+    std::string suffix;
+    for (auto& input : inputShapes) {
+        std::string dims;
+        for (auto dim : input.second)
+            dims += (dims.empty() ? "" : "x") + std::to_string(dim);
+        suffix += (suffix.empty() ? "/shape=" : ";") + dims;
+    }
+
+    auto localNetwork = _networkReshaper(inputShapes);
+    PrepareNetwork(localNetwork);
+    renameShapeDependentConstants(localNetwork, _clonedNetwork, suffix);
+    return localNetwork;
+}
+
+std::shared_ptr<MKLDNNGraph> MKLDNNExecNetwork::GetSpecializedGraph(Graph& graph, const InputShapes& inputShapes,
+                                                                    const CNNNetwork& specializedNetwork) {
+    auto& graphs = graph._specializedGraphs;
+    auto found = std::find_if(graphs.begin(), graphs.end(), [&](const std::pair<InputShapes, std::shared_ptr<MKLDNNGraph>>& item) {
+        return item.first == inputShapes;
+    });
+    if (found != graphs.end()) {
+        graphs.splice(graphs.begin(), graphs, found);
+        return graphs.front().second;
+    }
+
+    const size_t cacheSize = GetShapeCacheSize();
+    auto specializedGraph = CreateSpecializedGraph(specializedNetwork);
+
+    while (graphs.size() >= cacheSize)
+        graphs.pop_back();
+    graphs.emplace_front(inputShapes, specializedGraph);
+    return specializedGraph;
+}
+
+std::shared_ptr<MKLDNNGraph> MKLDNNExecNetwork::CreateSpecializedGraph(const CNNNetwork& specializedNetwork) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::CreateSpecializedGraph");
+
+    int numaNodeId = 0;
+    if (auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get()))
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+
+    // the network is shared by the streams, so every graph is created from its own copy
+    auto localNetwork = cloneNetwork(specializedNetwork);
+    auto specializedGraph = std::make_shared<MKLDNNGraph>();
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        specializedGraph->setConfig(_cfg);
+    }
+    specializedGraph->tuningCache = _tuningCache;
+    specializedGraph->CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+    return specializedGraph;
+}
+
+void MKLDNNExecNetwork::TuneGraph() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::TuneGraph");
+    constexpr int inferencesCount = 10;
+    auto inputsInfo = _clonedNetwork.getInputsInfo();
+
+    // Deterministic pseudo-random data, so the primitives aren't measured on zeros, which some of them process faster
+    auto makeInput = [&] (const std::string& name, const SizeVector& dims) {
+        const bool isIntegral = !inputsInfo.at(name)->getPrecision().is_float();
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)));
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        uint32_t state = 1;
+        for (size_t i = 0; i < blob->size(); i++) {
+            state = state * 1664525u + 1013904223u;
+            const auto value = static_cast<float>(state >> 24);
+            data[i] = isIntegral ? value : value / 127.5f - 1.0f;
+        }
+        return blob;
+    };
+
+    // Creates the graph with the current decisions and returns the average execution time of the nodes of every
+    // tunable signature along with the reorders adjacent to them, since a descriptor may require reorders
+    auto measureSignatures = [&] {
+        MKLDNNGraph graph;
+        graph.setConfig(_cfg);
+        graph.tuningCache = _tuningCache;
+        MKLDNNWeightsSharing::Ptr noWeightsCache;
+        graph.CreateGraph(cloneNetwork(_clonedNetwork), extensionManager, noWeightsCache);
+        for (auto& input : graph.GetInputNodes()) {
+            auto dims = input.second->getChildEdgeAt(0)->getDims().ToSizeVector();
+            graph.PushInputData(input.first, makeInput(input.first, dims));
+        }
+
+        graph.Infer();
+        for (auto& node : graph.GetNodes())
+            node->PerfCounter() = PerfCount();
+        for (int i = 0; i < inferencesCount; i++)
+            graph.Infer();
+
+        std::map<std::string, uint64_t> times;
+        for (auto& node : graph.GetNodes()) {
+            if (!MKLDNNTuningCache::IsTunable(*node))
+                continue;
+            uint64_t time = node->PerfCounter().avg_ns();
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parent = node->getParentEdgeAt(i)->getParent();
+                if (parent->getType() == Reorder)
+                    time += parent->PerfCounter().avg_ns();
+            }
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                auto child = node->getChildEdgeAt(i)->getChild();
+                if (child->getType() == Reorder)
+                    time += child->PerfCounter().avg_ns();
+            }
+            times[MKLDNNTuningCache::GetSignature(*node)] += time;
+        }
+        return times;
+    };
+
+    // the fastest candidate index and its time per tuned signature
+    std::map<std::string, std::pair<int, uint64_t>> best;
+    auto times = measureSignatures();
+    auto tunableNodes = _tuningCache->GetTunableNodes();
+    int maxCandidatesCount = 0;
+    for (auto& tunableNode : tunableNodes) {
+        auto& signature = tunableNode.first;
+        auto& candidates = tunableNode.second;
+        if (candidates.selected < 0 || (candidates.isStored && _cfg.tuningMode != Config::TuningMode::TuningRetune) ||
+            times.find(signature) == times.end())
+            continue;
+        best[signature] = {candidates.selected, times[signature]};
+        maxCandidatesCount = std::max(maxCandidatesCount, candidates.candidatesCount);
+    }
+
+    auto measureCandidate = [&] (int index, const std::vector<std::string>& signatures) {
+        for (auto& signature : signatures)
+            _tuningCache->Store(signature, index);
+        try {
+            auto candidateTimes = measureSignatures();
+            for (auto& signature : signatures) {
+                auto time = candidateTimes.find(signature);
+                if (time != candidateTimes.end() && time->second < best[signature].second)
+                    best[signature] = {index, time->second};
+            }
+        } catch (...) {
+            for (auto& signature : signatures)
+                _tuningCache->Store(signature, best[signature].first);
+            throw;
+        }
+        for (auto& signature : signatures)
+            _tuningCache->Store(signature, best[signature].first);
+    };
+
+    // all the signatures are switched to the same candidate index at once, so the number of created graphs is
+    // the number of candidates of the node having the most of them rather than the number of all the candidates
+    for (int index = 0; index < maxCandidatesCount; index++) {
+        std::vector<std::string> signatures;
+        for (auto& signature : best) {
+            auto& candidates = tunableNodes[signature.first];
+            if (index < candidates.candidatesCount && index != candidates.selected)
+                signatures.push_back(signature.first);
+        }
+        if (signatures.empty())
+            continue;
+
+        try {
+            measureCandidate(index, signatures);
+        } catch (...) {
+            // some candidate can't be used with the descriptors of the neighbour nodes, so the candidates are
+            // measured one by one to skip just that one
+            for (auto& signature : signatures) {
+                try {
+                    measureCandidate(index, {signature});
+                } catch (...) {
+                }
+            }
+        }
+    }
+
+    for (auto& signature : best)
+        _tuningCache->Store(signature.first, signature.second.first);
+    _tuningCache->Save();
+}
+
+bool MKLDNNExecNetwork::CanBatchRequests() {
+    auto graphLock = GetGraph();
+    auto& graph = graphLock._graph;
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() == MemoryInput)
+            return false;
+    }
+
+    for (auto& input : _clonedNetwork.getInputsInfo()) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != 1 || graph.hasMeanImageFor(input.first))
+            return false;
+    }
+
+    // outputs of the requests are the consecutive parts of the batched outputs
+    BlobMap outputs;
+    graph.getOutputBlobs(outputs);
+    for (auto& output : outputs) {
+        const auto& desc = output.second->getTensorDesc();
+        if (desc.getDims().empty() || desc.getDims()[0] != 1 || desc.getBlockingDesc().getOrder()[0] != 0)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNExecNetwork::CreateBatchedGraphs() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::CreateBatchedGraphs");
+
+    // the batched input blobs are filled by the request blobs one after another and passed to the graph as is,
+    // the inputs info of the requests isn't set yet, so it's taken from the network
+    const auto networkInputs = _clonedNetwork.getInputsInfo();
+    for (auto& input : networkInputs) {
+        const auto& desc = input.second->getTensorDesc();
+        if (desc.getLayout() == Layout::ANY || desc.getLayout() == Layout::BLOCKED || desc.getLayout() == Layout::SCALAR ||
+            desc.getBlockingDesc().getOrder()[0] != 0)
+            return;
+        switch (desc.getPrecision()) {
+            case Precision::FP32: case Precision::BF16: case Precision::I32: case Precision::I8:
+            case Precision::U8: case Precision::BOOL:
+                break;
+            default:
+                return;
+        }
+    }
+
+    // The networks are reshaped and transformed once for every batch the requests are coalesced to, which is
+    // a power of two or the maximal batch, and the graphs of all the streams are created from them
+    const size_t maxBatch = _requestsBatcher->GetMaxBatch();
+    std::vector<size_t> batches;
+    for (size_t batch = 2; batch < maxBatch; batch *= 2)
+        batches.push_back(batch);
+    batches.push_back(maxBatch);
+
+    std::map<size_t, std::pair<InputShapes, CNNNetwork>> batchedNetworks;
+    for (auto batch : batches) {
+        InputShapes inputShapes;
+        for (auto& input : networkInputs) {
+            auto dims = input.second->getTensorDesc().getDims();
+            dims[0] = batch;
+            inputShapes[input.first] = dims;
+        }
+        // The network may contain subgraphs which don't depend on the input shapes (e.g. reshape patterns with
+        // the batch hardcoded), in this case the requests are inferred one by one
+        try {
+            batchedNetworks[batch] = {inputShapes, CreateSpecializedNetwork(inputShapes)};
+        } catch (...) {
+            continue;
+        }
+    }
+
+    auto createGraphs = [&] {
+        auto graphLock = GetGraph();
+        BlobMap outputs;
+        graphLock._graph.getOutputBlobs(outputs);
+        for (auto& batchedNetwork : batchedNetworks) {
+            const size_t batch = batchedNetwork.first;
+            Graph::BatchedGraph batchedGraph;
+            try {
+                batchedGraph._graph = CreateSpecializedGraph(batchedNetwork.second.second);
+            } catch (...) {
+                continue;
+            }
+
+            // outputs of the requests are the consecutive parts of the batched outputs
+            BlobMap batchedOutputs;
+            batchedGraph._graph->getOutputBlobs(batchedOutputs);
+            bool isSplittable = true;
+            for (auto& output : outputs) {
+                auto batchedOutput = batchedOutputs.find(output.first);
+                if (batchedOutput == batchedOutputs.end()) {
+                    isSplittable = false;
+                    break;
+                }
+                const auto& desc = batchedOutput->second->getTensorDesc();
+                isSplittable = isSplittable && desc.getDims()[0] == batch && desc.getBlockingDesc().getOrder()[0] == 0 &&
+                               batchedOutput->second->size() == output.second->size() * batch;
+            }
+            if (!isSplittable)
+                continue;
+
+            for (auto& input : networkInputs) {
+                const auto& desc = input.second->getTensorDesc();
+                auto& blob = batchedGraph._inputs[input.first];
+                blob = make_blob_with_precision(TensorDesc(desc.getPrecision(), batchedNetwork.second.first[input.first], desc.getLayout()));
+                blob->allocate();
+            }
+            graphLock._graph._batchedGraphs.emplace(batch, std::move(batchedGraph));
+        }
+    };
+
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        std::vector<Task> tasks(_graphs.size(), createGraphs);
+        _taskExecutor->runAndWait(tasks);
+    } else {
+        createGraphs();
+    }
+}
+
+bool MKLDNNExecNetwork::InferBatch(const std::vector<MKLDNNInferRequest*>& requests) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::InferBatch");
+
+    size_t batch = 1;
+    while (batch < requests.size())
+        batch *= 2;
+    batch = std::min(batch, _requestsBatcher->GetMaxBatch());
+
+    // the graphs are created on LoadNetwork, the batches they can't be created for are inferred one by one
+    auto graphLock = GetGraph();
+    auto& batchedGraphs = graphLock._graph._batchedGraphs;
+    auto found = batchedGraphs.find(batch);
+    if (found == batchedGraphs.end())
+        return false;
+
+    auto& graph = *found->second._graph;
+    auto& inputs = found->second._inputs;
+    parallel_for(requests.size(), [&](size_t i) {
+        requests[i]->PushToBatch(inputs, i);
+    });
+    for (auto& input : inputs) {
+        // the tail of the incomplete batch is computed from zeros
+        const size_t itemSize = input.second->byteSize() / batch;
+        std::memset(input.second->buffer().as<uint8_t*>() + requests.size() * itemSize, 0, (batch - requests.size()) * itemSize);
+        graph.PushInputData(input.first, input.second);
+    }
+
+    graph.Infer();
+
+    parallel_for(requests.size(), [&](size_t i) {
+        requests[i]->PullFromBatch(graph, i);
+    });
+    return true;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -320,6 +806,12 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
         if (graphLock._graph.IsReady()) {
             graphLock._graph.setProperty(properties);
         }
+        for (auto& specializedGraph : graphLock._graph._specializedGraphs) {
+            specializedGraph.second->setProperty(properties);
+        }
+        for (auto& batchedGraph : graphLock._graph._batchedGraphs) {
+            batchedGraph.second._graph->setProperty(properties);
+        }
     }
 }
 
@@ -334,6 +826,17 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+
+    if (!_exportedFunctionProvider)
+        IE_THROW(NotImplemented) << "Export is supported only for networks represented as nGraph function";
+
+    auto exportedFunction = _exportedFunctionProvider();
+    SerializeNetwork(modelStream, exportedFunction.first, exportedFunction.second,
+                     _networkInputs, _networkOutputs, extensionManager->GetOpSets());
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
@@ -359,6 +862,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_STREAMS_TASK_RATE));
+        metrics.push_back(METRIC_KEY(CPU_STREAMS_QUEUE_WAIT_TIME));
+        metrics.push_back(METRIC_KEY(CPU_NUMA_MEMORY_FOOTPRINT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,6 +879,44 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_STREAMS_TASK_RATE) || name == METRIC_KEY(CPU_STREAMS_QUEUE_WAIT_TIME)) {
+        // the executor is shared by all the requests of the network unless exclusive async requests are used
+        CPUStreamsExecutor::Statistics statistics;
+        if (auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor))
+            statistics = streamsExecutor->GetStatistics();
+        if (name == METRIC_KEY(CPU_STREAMS_TASK_RATE)) {
+            IE_SET_METRIC_RETURN(CPU_STREAMS_TASK_RATE, static_cast<float>(statistics._taskRate));
+        } else {
+            IE_SET_METRIC_RETURN(CPU_STREAMS_QUEUE_WAIT_TIME, static_cast<float>(statistics._averageQueueWaitTime));
+        }
+    } else if (name == METRIC_KEY(CPU_NUMA_MEMORY_FOOTPRINT)) {
+        std::map<int, std::unordered_map<const void*, size_t>> blocks;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (!graphLock._graph.IsReady())
+                continue;
+            auto& nodeBlocks = blocks[graphLock._graph.GetNumaNodeId()];
+            graphLock._graph.GetMemoryBlocks(nodeBlocks);
+            for (auto& specializedGraph : graphLock._graph._specializedGraphs)
+                specializedGraph.second->GetMemoryBlocks(nodeBlocks);
+            for (auto& batchedGraph : graphLock._graph._batchedGraphs)
+                batchedGraph.second._graph->GetMemoryBlocks(nodeBlocks);
+        }
+        std::map<int, std::uint64_t> footprint;
+        for (auto numaNodeId : getAvailableNUMANodes()) {
+            auto& size = footprint[numaNodeId];
+            for (auto& block : blocks[numaNodeId])
+                size += block.second;
+        }
+        {
+            std::lock_guard<std::mutex> lock{_numaMemoryMutex};
+            for (auto& requestsMemory : _requestsNumaMemory) {
+                auto found = footprint.find(requestsMemory.first);
+                if (found != footprint.end())
+                    found->second += requestsMemory.second;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_NUMA_MEMORY_FOOTPRINT, footprint);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -8,12 +8,17 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_requests_batcher.h"
 #include <threading/ie_thread_local.hpp>
+#include <ngraph/function.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
 #include <string>
+#include <functional>
+#include <future>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -22,6 +27,15 @@ namespace MKLDNNPlugin {
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
+    typedef std::map<std::string, InferenceEngine::SizeVector> InputShapes;
+    /**
+     * Returns the network reshaped to the given input shapes and converted to the form accepted by the constructor
+     */
+    typedef std::function<InferenceEngine::CNNNetwork(const InputShapes&)> NetworkReshaper;
+    /**
+     * Returns the function which is written on Export and whether the common transformations are applied to it
+     */
+    typedef std::function<std::pair<std::shared_ptr<ngraph::Function>, bool>()> ExportedFunctionProvider;
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -30,7 +44,9 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const ExportedFunctionProvider &exportedFunctionProvider = nullptr,
+                      const NetworkReshaper &networkReshaper = nullptr);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -42,6 +58,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -56,6 +74,14 @@ protected:
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        // Graphs specialized for other input shapes. The most recently used one is the first
+        std::list<std::pair<InputShapes, std::shared_ptr<MKLDNNGraph>>> _specializedGraphs;
+        struct BatchedGraph {
+            std::shared_ptr<MKLDNNGraph>    _graph;
+            InferenceEngine::BlobMap        _inputs;
+        };
+        // Graphs the coalesced requests are inferred by, per batch
+        std::map<size_t, BatchedGraph>      _batchedGraphs;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -64,6 +90,19 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    ExportedFunctionProvider                    _exportedFunctionProvider;
+    NetworkReshaper                             _networkReshaper;
+    bool                                        _isShapeCacheEnabled = false;
+    // Networks transformed for other input shapes, the graphs of all the streams are created from them.
+    // The most recently used one is the first
+    std::list<std::pair<InputShapes, std::shared_future<InferenceEngine::CNNNetwork>>> _specializedNetworks;
+    std::mutex                                  _specializedNetworksMutex;
+    MKLDNNRequestsBatcher::Ptr                  _requestsBatcher;
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessingExecutor;
+    MKLDNNTuningCache::Ptr                      _tuningCache;
+    mutable std::mutex                          _numaMemoryMutex;
+    // size of the blobs allocated by infer requests per NUMA node
+    std::map<int, std::uint64_t>                _requestsNumaMemory;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -71,6 +110,60 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    /**
+     * Returns the network reshaped and transformed for the input shapes from the cache shared by all the streams.
+     * The network is created once per shapes by the first caller, others wait for it. Must not be called under
+     * the lock of a stream graph, so the transformations don't block the inference of the stream.
+     */
+    InferenceEngine::CNNNetwork GetSpecializedNetwork(const InputShapes& inputShapes);
+
+    InferenceEngine::CNNNetwork CreateSpecializedNetwork(const InputShapes& inputShapes);
+
+    /**
+     * Returns the graph specialized for the input shapes from the cache of the locked stream graph, the graph is
+     * created from the specialized network if it's not cached. The least recently used graph is dropped if
+     * the cache is full, so the caller keeps the returned pointer while the graph is used.
+     */
+    std::shared_ptr<MKLDNNGraph> GetSpecializedGraph(Graph& graph, const InputShapes& inputShapes,
+                                                     const InferenceEngine::CNNNetwork& specializedNetwork);
+
+    std::shared_ptr<MKLDNNGraph> CreateSpecializedGraph(const InferenceEngine::CNNNetwork& specializedNetwork);
+
+    size_t GetShapeCacheSize();
+
+    bool IsShapeCacheEnabled() const {
+        return _isShapeCacheEnabled;
+    }
+
+    /**
+     * Returns true if requests can be coalesced: all inputs and outputs have batch 1 in the outermost dimension,
+     * the inputs have no mean images and the network has no states
+     */
+    bool CanBatchRequests();
+
+    /**
+     * Creates the graphs of every stream for the batches the requests are coalesced to. The graphs aren't created
+     * if the network can't be reshaped to a batch or the input blobs can't be concatenated without conversion.
+     */
+    void CreateBatchedGraphs();
+
+    /**
+     * Infers the requests by the graph of the locked stream reshaped to the batch, which is the number of
+     * the requests rounded up to a power of two or the maximal batch. Returns false if there is no graph
+     * for the batch.
+     */
+    bool InferBatch(const std::vector<MKLDNNInferRequest*>& requests);
+
+    /**
+     * Chooses primitive descriptors of the tunable nodes. A graph is created per candidate index with all
+     * the signatures switched to it, and every signature is measured locally: the execution time of its nodes
+     * together with the reorders adjacent to them. The fastest candidates are stored to the tuning cache and
+     * saved to the tuning file.
+     */
+    void TuneGraph();
+
+    void PrepareNetwork(InferenceEngine::CNNNetwork& network) const;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
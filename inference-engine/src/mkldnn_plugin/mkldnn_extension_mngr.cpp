@@ -15,6 +15,15 @@ void MKLDNNExtensionManager::AddExtension(IExtensionPtr extension) {
     _extensions.push_back(extension);
 }
 
+std::map<std::string, ngraph::OpSet> MKLDNNExtensionManager::GetOpSets() const {
+    std::map<std::string, ngraph::OpSet> opsets;
+    for (const auto& ext : _extensions) {
+        auto extOpsets = ext->getOpSets();
+        opsets.insert(extOpsets.begin(), extOpsets.end());
+    }
+    return opsets;
+}
+
 InferenceEngine::ILayerImpl::Ptr MKLDNNExtensionManager::CreateImplementation(const std::shared_ptr<ngraph::Node>& op) {
     if (!op)
         IE_THROW() << "Cannot get nGraph operation!";
@@ -31,12 +31,17 @@
 #include <blob_factory.hpp>
 #include <legacy/net_pass.h>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <ngraph/op/parameter.hpp>
+#include <ngraph/op/result.hpp>
+#include <transformations/utils/utils.hpp>
 #include "nodes/common/cpu_convert.h"
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/blob_dump.h"
+#include "utils/numa_utils.h"
 #include "utils/general_utils.h"
 
 /*****************************************************
@@ -102,7 +107,9 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.shapeCacheSize > 0 ? w_cache : nullptr;
+    // the graph is created on a thread of the stream it's used by, so its memory is placed on the node of the cache
+    numaNodeId = w_cache ? w_cache->GetNumaNodeId() : -1;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -214,6 +221,12 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 
     this->_name = network.getName();
 
+    // the plugin keeps ngraph representation of the network only if all the operations can be created directly
+    if (auto function = network.getFunction()) {
+        Replicate(function, inputs, network.getOutputsInfo());
+        return;
+    }
+
     // The input layer precision has to be equal to the InputData precision
     std::map<std::string, Precision> changedPrecision;
     for (const auto& input : inputs) {
@@ -313,18 +326,111 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     for (const auto& input : inputs) {
         auto inputLayer = getCreatorLayer(input.second->getInputData()).lock();
         inputNodes[input.first] = layer2node[inputLayer];
+    }
+
+    LoadMeanImages(inputs);
+}
+
+void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &function, const InputsDataMap& inputsInfo,
+                            const OutputsDataMap& outputsInfo) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::ReplicateFunction");
+
+    std::unordered_map<const ngraph::Node*, MKLDNNNodePtr> op2node;
+    // outputs which have no consumers and aren't marked as graph outputs
+    std::vector<ngraph::Output<ngraph::Node>> unusedOutputs;
+
+    for (const auto& op : function->get_ordered_ops()) {
+        const MKLDNNNodePtr node(MKLDNNNode::ngraphFactory().create(op, getEngine(), weightsCache));
+
+        if (ngraph::is_type<ngraph::op::v0::Parameter>(op)) {
+            auto input = inputsInfo.find(node->getName());
+            if (input == inputsInfo.end())
+                IE_THROW() << "Parameter " << node->getName() << " isn't found in the network inputs";
+            // the precision of the network input can be changed by the user
+            node->setOriginalOutputPrecisionAtPort(0, input->second->getPrecision());
+            inputNodes[input->first] = node;
+        }
+
+        if (ngraph::is_type<ngraph::op::v0::Result>(op)) {
+            const auto outputName = ngraph::op::util::create_ie_output_name(op->input_value(0));
+            auto output = outputsInfo.find(outputName);
+            if (output == outputsInfo.end())
+                IE_THROW() << "Result " << op->get_friendly_name() << " isn't found in the network outputs";
+            node->name = "out_" + output->first;
+            node->setOriginalInputPrecisionAtPort(0, output->second->getPrecision());
+            outputNodes.push_back(node);
+        }
+
+        graphNodes.push_back(node);
+        op2node[op.get()] = node;
+
+        for (size_t port = 0; port < op->get_input_size(); port++) {
+            const auto parentOutput = op->input_value(port);
+            const auto parentNode = op2node[parentOutput.get_node()];
+
+            MKLDNNEdgePtr edge(new MKLDNNEdge(parentNode, node, static_cast<int>(parentOutput.get_index()), static_cast<int>(port)));
+            node->addEdge(edge);
+            graphEdges.push_back(edge);
+        }
+
+        if (!ngraph::is_type<ngraph::op::v0::Result>(op)) {
+            for (const auto& output : op->outputs()) {
+                if (output.get_target_inputs().empty())
+                    unusedOutputs.push_back(output);
+            }
+        }
+    }
 
-        // Loading mean images
+    // Add stub output node for unused data
+    for (const auto& unusedOutput : unusedOutputs) {
+        const auto parentNode = op2node[unusedOutput.get_node()];
+        const auto port = unusedOutput.get_index();
+        // the stub isn't connected to the function, which is shared by the graphs of all streams
+        auto placeholder = std::make_shared<ngraph::op::v0::Parameter>(unusedOutput.get_element_type(), unusedOutput.get_shape());
+        auto stub = std::make_shared<ngraph::op::v0::Result>(placeholder);
+        stub->set_friendly_name("stub_" + parentNode->getName() + "_" + std::to_string(port));
+
+        const MKLDNNNodePtr node(MKLDNNNode::ngraphFactory().create(stub, getEngine(), weightsCache));
+
+        MKLDNNEdgePtr edge(new MKLDNNEdge(parentNode, node, static_cast<int>(port), 0));
+        node->addEdge(edge);
+        graphEdges.push_back(edge);
+        graphNodes.push_back(node);
+    }
+
+    LoadMeanImages(inputsInfo);
+}
+
+bool MKLDNNGraph::CanReplicate(const std::shared_ptr<const ngraph::Function> &function) {
+    if (!function->get_sinks().empty())
+        return false;
+
+    static const std::vector<ngraph::element::Type> supportedPrecisions = {
+        ngraph::element::f32, ngraph::element::i32, ngraph::element::u8, ngraph::element::i8
+    };
+    for (const auto& op : function->get_ordered_ops()) {
+        if (!MKLDNNNode::ngraphFactory().isSupported(op))
+            return false;
+        for (const auto& output : op->outputs()) {
+            if (output.get_partial_shape().is_dynamic())
+                return false;
+            if (std::find(supportedPrecisions.begin(), supportedPrecisions.end(), output.get_element_type()) == supportedPrecisions.end())
+                return false;
+        }
+    }
+    return true;
+}
+
+void MKLDNNGraph::LoadMeanImages(const InputsDataMap& inputs) {
+    for (const auto& input : inputs) {
         MKLDNNDims outDims;
         if (!inputNodes[input.first]->getChildEdgeAt(0)->getDims().ndims())
             outDims = MKLDNNDims(InferenceEngine::SizeVector(1, 1));
         else
             outDims = MKLDNNDims(inputNodes[input.first]->getChildEdgeAt(0)->getDims());
-        if (inputs.find(input.first) != inputs.end()) {
-            InputInfo::Ptr ii = inputs[input.first];
-            if (ii && ii->getPreProcess().getNumberOfChannels()) {
-                _meanImages[input.first].Load(outDims, ii);
-            }
+        InputInfo::Ptr ii = input.second;
+        if (ii && ii->getPreProcess().getNumberOfChannels()) {
+            _meanImages[input.first].Load(outDims, ii);
         }
     }
 }
@@ -347,6 +453,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -436,7 +544,10 @@ void MKLDNNGraph::InitDescriptors() {
 
     for (auto &node : graphNodes) {
         OV_ITT_TASK_NEXT(taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        if (tuningCache)
+            tuningCache->SelectPrimitiveDescriptor(*node);
+        else
+            node->selectOptimalPrimitiveDescriptor();
     }
 }
 
@@ -517,7 +628,7 @@ void MKLDNNGraph::InitEdges() {
 
     std::unordered_set<std::string> uniqueLayerNames;
     for (auto node : graphNodes) {
-        uniqueLayerNames.insert(node->getCnnLayer()->name);
+        uniqueLayerNames.insert(node->getName());
     }
 
     for (auto i = 0; i < numberOfEdges; i++) {
@@ -643,13 +754,18 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // Nodes of the same execution level may run concurrently, so their memory must not be shared
+    auto execTime = [this](const MKLDNNNodePtr& node) {
+        return nodesExecutionLevel.empty() ? node->execIndex : nodesExecutionLevel[node->execIndex];
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execTime(edge->getParent());
+            int e_finish = execTime(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -700,7 +816,10 @@ void MKLDNNGraph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    // map the workspace pages on the node of the stream right away, rather than on the node of the thread
+    // which happens to write them first during the inference
+    if (memWorkspace->CreateOnNumaNode(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), numaNodeId))
+        firstTouch(memWorkspace->GetData(), total_size);
 
     if (edge_clusters.empty())
         return;
@@ -729,6 +848,23 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::GetMemoryBlocks(std::unordered_map<const void*, size_t>& blocks) const {
+    auto count = [&](const MKLDNNMemoryPtr& memory) {
+        if (memory && memory->GetPrimitivePtr())
+            blocks.emplace(memory->GetData(), memory->GetSize());
+    };
+    count(memWorkspace);
+    for (auto& edge : graphEdges) {
+        // in-place views of constants share the data pointer with the parent memory
+        if (edge->getParent()->isConstant())
+            count(edge->getMemoryPtr());
+    }
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory)
+            count(memory);
+    }
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -837,30 +973,107 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
-void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
-    if (!IsReady()) {
-        IE_THROW() << "Wrong state. Topology is not ready.";
+void MKLDNNGraph::InitExecutionLevels() {
+    executionLevels.clear();
+    nodesExecutionLevel.clear();
+    levelStreams.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return;
+
+    // graphNodes are sorted topologically, so all parents are visited before a node
+    std::vector<int> levels(graphNodes.size(), 0);
+    int levelsCount = 0;
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (auto &parentEdge : node->getParentEdges()) {
+            if (auto edge = parentEdge.lock())
+                level = std::max(level, levels[edge->getParent()->execIndex] + 1);
+        }
+        levels[node->execIndex] = level;
+        levelsCount = std::max(levelsCount, level + 1);
     }
 
-    mkldnn::stream stream(eng);
+    std::vector<std::vector<MKLDNNNodePtr>> nodesByLevel(levelsCount);
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            nodesByLevel[levels[node->execIndex]].push_back(node);
+    }
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
+    size_t maxLevelWidth = 0;
+    for (auto &level : nodesByLevel) {
+        if (level.empty())
+            continue;
+        maxLevelWidth = std::max(maxLevelWidth, level.size());
+        executionLevels.push_back(std::move(level));
+    }
+
+    // Sequential chain of nodes doesn't benefit from concurrent execution, while the memory reuse gets worse
+    if (maxLevelWidth < 2) {
+        executionLevels.clear();
+        return;
+    }
+
+    nodesExecutionLevel = std::move(levels);
+    for (size_t i = 0; i < maxLevelWidth; i++)
+        levelStreams.emplace_back(eng);
+#endif
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, MKLDNNInferRequest* request, int batch) {
+    if (request != nullptr) {
+        request->ThrowIfCanceled();
+    }
+
+    PERF(node);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        node->execute(stream);
+    }
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
+
+void MKLDNNGraph::InferParallelBranches(MKLDNNInferRequest* request, int batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    for (auto &level : executionLevels) {
+        if (level.size() == 1) {
+            ExecuteNode(level.front(), levelStreams.front(), request, batch);
+            continue;
         }
 
-        PERF(graphNodes[i]);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, level.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); i++) {
+                // Isolation prevents a thread waiting inside the parallel region of one node
+                // from taking another node of the level and executing it on the same stack
+                tbb::this_task_arena::isolate([&] {
+                    ExecuteNode(level[i], levelStreams[i], request, batch);
+                });
+            }
+        }, tbb::simple_partitioner());
+    }
+#endif
+}
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
+    if (!IsReady()) {
+        IE_THROW() << "Wrong state. Topology is not ready.";
+    }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    if (!executionLevels.empty()) {
+        InferParallelBranches(request, batch);
+    } else {
+        mkldnn::stream stream(eng);
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+        for (auto &graphNode : graphNodes) {
+            ExecuteNode(graphNode, stream, request, batch);
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
     if (infer_count != -1) infer_count++;
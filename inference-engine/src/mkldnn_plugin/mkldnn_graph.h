@@ -11,12 +11,14 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_tuning_cache.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -24,6 +26,8 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    // primitive descriptors chosen by measurements, nullptr if the tuning is disabled
+    MKLDNNTuningCache::Ptr tuningCache;
 
     enum Status {
         NotReady = 0,
@@ -73,6 +77,19 @@ public:
         return graphEdges;
     }
 
+    /**
+     * NUMA node the graph memory is placed on, -1 if the placement isn't managed
+     */
+    int GetNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    /**
+     * Adds the activations workspace and the constants memory used by the graph to the map keyed by the data
+     * pointer, so the memory shared between graphs through the weights cache is counted once
+     */
+    void GetMemoryBlocks(std::unordered_map<const void*, size_t>& blocks) const;
+
     std::vector<MKLDNNNodePtr>& GetOutputNodes() {
         return outputNodes;
     }
@@ -157,6 +174,13 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * @brief Checks if the graph can be created from the function directly, without the conversion to CNNNetwork
+     * @param function Function with operations of CPU specific opset
+     * @return true if all the operations have nodes which can be created from ngraph operations
+     */
+    static bool CanReplicate(const std::shared_ptr<const ngraph::Function> &function);
+
     void SortTopologically();
 
 protected:
@@ -171,6 +195,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        executionLevels.clear();
+        nodesExecutionLevel.clear();
+        levelStreams.clear();
     }
     Status status { NotReady };
     Config config;
@@ -182,6 +209,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    int numaNodeId = -1;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -191,21 +219,35 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Non constant nodes grouped by the length of the longest path from graph sources. Nodes of one level
+    // don't depend on each other and are executed concurrently. Empty if parallel branches are disabled.
+    std::vector<std::vector<MKLDNNNodePtr>> executionLevels;
+    // Execution level of each node indexed by execIndex. Used instead of execIndex as a memory live time.
+    std::vector<int> nodesExecutionLevel;
+    std::vector<mkldnn::stream> levelStreams;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
+    void Replicate(const std::shared_ptr<const ngraph::Function> &function, const InferenceEngine::InputsDataMap& inputsInfo,
+                   const InferenceEngine::OutputsDataMap& outputsInfo);
+    void LoadMeanImages(const InferenceEngine::InputsDataMap& inputs);
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
 
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, MKLDNNInferRequest* request, int batch);
+    void InferParallelBranches(MKLDNNInferRequest* request, int batch);
+
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
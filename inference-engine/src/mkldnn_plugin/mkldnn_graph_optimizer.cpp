@@ -17,6 +17,7 @@
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 
 #include "mkldnn/ie_mkldnn.h"
 
@@ -40,6 +41,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <cmath>
 
 #include "mkldnn_itt.h"
 
@@ -70,6 +72,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     FuseConvolutionAndDepthwise(graph);
     graph.RemoveDroppedNodes();
 
@@ -162,6 +167,10 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
         if (node->getParentEdges().size() < 2)
             return false;
 
+        // zero points are looked up through the legacy layers, nodes created from ngraph operations have none
+        if (!node->getCnnLayer())
+            return false;
+
         auto* convLayer = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
         if (convLayer == nullptr)
             IE_THROW() << "Cannot get convolution layer " << node->getName();
@@ -377,6 +386,149 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableFCNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || node->getParentEdges().size() < 2)
+            return false;
+
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot get fully connected node " << node->getName();
+
+        // the kernel takes FP32 rows only. It isn't a limitation in practice: the compressed weights are FakeQuantize
+        // for the rest of the plugin, so such a model is not converted to BF16 even if ENFORCE_BF16 is set
+        return MKLDNNFullyConnectedNode::isWeightsDecompressionSupported() &&
+               node->getCnnLayer()->insData[0].lock()->getPrecision() == Precision::FP32 &&
+               node->getCnnLayer()->outData[0]->getPrecision() == Precision::FP32;
+    };
+
+    // Const(I8/U8) -> [Convert] -> Quantize -> [Permute {1, 0}] -> FC weights, Permute may also be above Quantize
+    struct WeightsDecompression {
+        std::vector<MKLDNNNodePtr> nodes;
+        MKLDNNQuantizeNode* quantize = nullptr;
+        MKLDNNNodePtr weights;
+        bool transposed = false;
+        // Quantize gets the weights as [K, N] if the Permute goes after it
+        bool transposedQuantize = false;
+    };
+
+    auto matchWeightsDecompression = [](MKLDNNNodePtr fcNode, WeightsDecompression& pattern) {
+        auto node = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        while (node->getType() != Input) {
+            if (node->getChildEdges().size() != 1 || node->getParentEdges().empty())
+                return false;
+
+            if (node->getType() == Permute) {
+                auto* permuteNode = dynamic_cast<MKLDNNPermuteNode*>(node.get());
+                if (permuteNode == nullptr || pattern.transposed || permuteNode->getOrder() != SizeVector{1, 0})
+                    return false;
+                pattern.transposed = true;
+                pattern.transposedQuantize = pattern.quantize == nullptr;
+            } else if (node->getType() == Quantize) {
+                auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+                if (quantizeNode == nullptr || pattern.quantize != nullptr || quantizeNode->isBinarization())
+                    return false;
+                pattern.quantize = quantizeNode;
+            } else if (node->getType() != Convert) {
+                return false;
+            }
+
+            pattern.nodes.push_back(node);
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        auto weightsLayer = node->getCnnLayer();
+        if (pattern.quantize == nullptr || !weightsLayer || weightsLayer->type != "Const" ||
+                !one_of(weightsLayer->outData[0]->getPrecision(), Precision::I8, Precision::U8) ||
+                node->getChildEdgeAt(0)->getDims().ndims() != 2)
+            return false;
+
+        pattern.weights = node;
+        return true;
+    };
+
+    // q * inputScale + inputShift is kept integral by rounding only if inputScale is 1 and inputShift is integral,
+    // so the Quantize is reduced to the linear function of the weights: q * outputScale + (inputShift * outputScale + outputShift)
+    auto initializeDecompression = [](MKLDNNNodePtr fcNode, const WeightsDecompression& pattern) {
+        const auto* quantize = pattern.quantize;
+        const size_t N = fcNode->getChildEdgeAt(0)->getDims()[fcNode->getChildEdgeAt(0)->getDims().ndims() - 1];
+        const size_t axis = pattern.transposedQuantize ? 1 : 0;
+
+        const std::vector<const std::vector<float>*> params = {&quantize->getCropLow(), &quantize->getCropHigh(), &quantize->getInputScale(),
+                                                               &quantize->getInputShift(), &quantize->getOutputScale(), &quantize->getOutputShift()};
+        for (const auto* param : params) {
+            if (param->size() != 1 && (param->size() != N || quantize->getAxis() != axis))
+                return false;
+        }
+
+        for (float inputScale : quantize->getInputScale()) {
+            if (std::abs(inputScale - 1.f) > 1e-6f)
+                return false;
+        }
+        for (float inputShift : quantize->getInputShift()) {
+            if (std::abs(inputShift - std::round(inputShift)) > 1e-4f)
+                return false;
+        }
+
+        auto weightsBlob = pattern.weights->getCnnLayer()->blobs["custom"];
+        if (weightsBlob == nullptr)
+            return false;
+
+        int minValue = 0, maxValue = 0;
+        if (weightsBlob->getTensorDesc().getPrecision() == Precision::I8) {
+            const auto* data = weightsBlob->cbuffer().as<const int8_t*>();
+            const auto range = std::minmax_element(data, data + weightsBlob->size());
+            minValue = *range.first;
+            maxValue = *range.second;
+        } else {
+            const auto* data = weightsBlob->cbuffer().as<const uint8_t*>();
+            const auto range = std::minmax_element(data, data + weightsBlob->size());
+            minValue = *range.first;
+            maxValue = *range.second;
+        }
+        if (*std::max_element(quantize->getCropLow().begin(), quantize->getCropLow().end()) > minValue ||
+                *std::min_element(quantize->getCropHigh().begin(), quantize->getCropHigh().end()) < maxValue)
+            return false;
+
+        const auto& inputShift = quantize->getInputShift();
+        const auto& outputScale = quantize->getOutputScale();
+        const auto& outputShift = quantize->getOutputShift();
+        const size_t size = std::max({inputShift.size(), outputScale.size(), outputShift.size()});
+        std::vector<float> scale(size), shift(size);
+        for (size_t i = 0; i < size; i++) {
+            const float ish = std::round(inputShift[inputShift.size() == 1 ? 0 : i]);
+            const float osc = outputScale[outputScale.size() == 1 ? 0 : i];
+            const float osh = outputShift[outputShift.size() == 1 ? 0 : i];
+            scale[i] = osc;
+            shift[i] = ish * osc + osh;
+        }
+
+        auto* fc = dynamic_cast<MKLDNNFullyConnectedNode*>(fcNode.get());
+        fc->setWeightsDecompression(std::move(scale), std::move(shift), pattern.transposed);
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (!isSutableFCNode(fc)) continue;
+
+        WeightsDecompression pattern;
+        if (!matchWeightsDecompression(fc, pattern) || !initializeDecompression(fc, pattern))
+            continue;
+
+        auto parents = pattern.quantize->parentEdges;
+        for (size_t j = 1; j < parents.size(); j++) {
+            auto p_edge = parents[j].lock();
+            removeEdge(graph, p_edge);
+        }
+
+        for (auto& node : pattern.nodes)
+            graph.DropNode(node);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     for (auto node : graph.GetNodes()) {
         // Split with at least 2 Convolutions
@@ -619,7 +771,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
                     }
                     graph.DropNode(ch1);
                 } else {
-                    if (ch1->type == Pooling) {
+                    if (ch1->type == Pooling && ch1->getCnnLayer()) {
                         auto pool = ch1;
 
                         auto* pLayer = dynamic_cast<PoolingLayer *>(pool->getCnnLayer().get());
@@ -645,8 +797,12 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+
+        // post ops are not applied by the kernel for compressed weights
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode == nullptr || !fcNode->withWeightsDecompression();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -752,7 +908,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableConv = (node->getType() == Convolution) &&
+        bool isSutableConv = (node->getType() == Convolution) && node->getCnnLayer() &&
                              node->getCnnLayer()->precision == Precision::FP32;
         bool isSutableBinConv = node->getType() == BinaryConvolution;
         return (isSutableConv || isSutableBinConv) && node->getChildEdges().size() == 1;
@@ -823,7 +979,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isConvolutionNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Convolution;
+        return node->getType() == Convolution && node->getCnnLayer();
     };
 
     auto is1x1Convolution = [](ConvolutionLayer* layer) {
@@ -925,7 +1081,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableBinConv = node->getType() == Convolution;
+        bool isSutableBinConv = node->getType() == Convolution && node->getCnnLayer();
 
         if (isSutableBinConv) {
             auto *convLayer = dynamic_cast<ConvolutionLayer *>(node->getCnnLayer().get());
@@ -980,6 +1136,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph)
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
         return node->getType() == Convolution &&
                node->getChildEdges().size() == 1 &&
+               node->getCnnLayer() &&
                node->getCnnLayer()->precision == Precision::FP32;
     };
 
@@ -1084,7 +1241,7 @@ void MKLDNNGraphOptimizer::FusePoolingAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutablePooling = node->getType() == Pooling;
+        bool isSutablePooling = node->getType() == Pooling && node->getCnnLayer();
 
         if (isSutablePooling) {
             auto *poolingLayer = dynamic_cast<PoolingLayer *>(node->getCnnLayer().get());
@@ -1756,7 +1913,8 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
 
 void MKLDNNGraphOptimizer::DropConvertReorder(MKLDNNGraph& graph) {
     for (auto input : graph.GetNodes()) {
-        if (input->getType() != Input) {
+        // Convert nodes are created by the legacy conversion only
+        if (input->getType() != Input || !input->getCnnLayer()) {
             continue;
         }
 
@@ -19,6 +19,11 @@
 #include "nodes/mkldnn_memory_node.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
+#include "utils/numa_utils.h"
+#include <ie_parallel.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <algorithm>
+#include <cstring>
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -28,9 +33,18 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
 
+    // requests are distributed between NUMA nodes the same way as streams, so every node serves its own requests
+    if (auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(execNetwork->_taskExecutor)) {
+        auto numaNodes = streamsExecutor->GetUsedNumaNodes();
+        if (!numaNodes.empty())
+            numaNodeId = numaNodes[id % numaNodes.size()];
+    }
+    numaAllocator = createNumaAllocator(numaNodeId);
+
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    shapeBuckets = graph->getProperty().shapeBuckets;
     for (const auto& it : _networkInputs) {
         MKLDNNInferRequest::GetBlob(it.first);
     }
@@ -65,9 +79,52 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
+    {
+        std::lock_guard<std::mutex> lock{execNetwork->_numaMemoryMutex};
+        for (const auto& blob : allocatedBlobs)
+            execNetwork->_requestsNumaMemory[numaNodeId] -= blob.second;
+    }
     --(execNetwork->_numRequests);
 }
 
+int MKLDNNPlugin::MKLDNNInferRequest::GetNumaNodeId() const {
+    return numaNodeId;
+}
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::allocateBlob(const std::string& name, const InferenceEngine::TensorDesc& desc) {
+    // every blob gets its own mapping bound to the node of the request if the system has several nodes
+    auto blob = numaAllocator ? make_blob_with_precision(desc, numaAllocator) : make_blob_with_precision(desc);
+    blob->allocate();
+
+    std::lock_guard<std::mutex> lock{execNetwork->_numaMemoryMutex};
+    auto& allocated = allocatedBlobs[name];
+    auto& footprint = execNetwork->_requestsNumaMemory[numaNodeId];
+    footprint -= allocated;
+    footprint += blob->byteSize();
+    allocated = blob->byteSize();
+    return blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::releaseBlob(const std::string& name) {
+    std::lock_guard<std::mutex> lock{execNetwork->_numaMemoryMutex};
+    auto found = allocatedBlobs.find(name);
+    if (found == allocatedBlobs.end())
+        return;
+    execNetwork->_requestsNumaMemory[numaNodeId] -= found->second;
+    allocatedBlobs.erase(found);
+}
+
+std::string MKLDNNPlugin::MKLDNNInferRequest::getShapeBlobName(const std::string& name, const InferenceEngine::SizeVector& dims) const {
+    // the blobs of the network shapes are accounted under the plain names, as they are allocated in the constructor
+    auto output = _networkOutputs.find(name);
+    if (output != _networkOutputs.end() && output->second->getTensorDesc().getDims() == dims)
+        return name;
+    std::string suffix;
+    for (auto dim : dims)
+        suffix += (suffix.empty() ? "/shape=" : "x") + std::to_string(dim);
+    return name + suffix;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
@@ -97,6 +154,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
+        auto padded = paddedInputs.find(input.first);
+        if (padded != paddedInputs.end()) {
+            input.second = padded->second;
+        }
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
@@ -145,13 +206,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
+            // The graph may still use the state buffers of the request inferred previously
+            cur_node->resetExternalState();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
                     auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                    auto variableState = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    auto stateBlob = variableState ? variableState->GetCurrentState() : state->GetState();
+                    auto data_ptr = stateBlob->cbuffer().as<void*>();
+                    auto data_size = stateBlob->byteSize();
+
+                    // The graph reads the state of the request and writes the next one in place
+                    if (variableState && data_size == cur_state_mem->GetSize() &&
+                        cur_node->setExternalState(data_ptr, variableState->GetNextState()->buffer()))
+                        continue;
 
+                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
                     cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
                 }
             }
@@ -166,12 +236,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                    auto variableState = std::static_pointer_cast<MKLDNNVariableState>(state);
+                    if (!cur_node->hasExternalState()) {
+                        auto cur_state_mem = cur_node->getStore();
+                        auto nextState = variableState->GetNextState();
+                        auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                        cpu_memcpy(nextState->buffer(), cur_state_mem_buf, nextState->byteSize());
+                    }
+                    variableState->CommitNextState();
                 }
             }
         }
@@ -182,12 +255,41 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
+
+    // the inputs pre-processed by the pipeline stage belong to this inference only
+    const bool preprocessed = areInputsPreprocessed;
+    areInputsPreprocessed = false;
+
+    ThrowIfCanceled();
+
+    if (!preprocessed)
+        execDataPreprocessing(_inputs);
+
+    // The network is transformed for other input shapes before the stream graph is locked,
+    // so only the primitives of the stream are created under the lock
+    std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+    InferenceEngine::CNNNetwork specializedNetwork;
+    bool isNetworkShapes = true;
+    if (execNetwork->IsShapeCacheEnabled()) {
+        inputShapes = GetInputShapes();
+        isNetworkShapes = std::all_of(inputShapes.begin(), inputShapes.end(),
+            [&](const std::pair<const std::string, InferenceEngine::SizeVector>& input) {
+                return input.second == _networkInputs[input.first]->getTensorDesc().getDims();
+            });
+        if (!isNetworkShapes)
+            specializedNetwork = execNetwork->GetSpecializedNetwork(inputShapes);
+    }
+
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
-    ThrowIfCanceled();
+    if (execNetwork->IsShapeCacheEnabled()) {
+        specializedGraph = isNetworkShapes ? nullptr : execNetwork->GetSpecializedGraph(graphLock._graph, inputShapes, specializedNetwork);
+        graph = isNetworkShapes ? &(graphLock._graph) : specializedGraph.get();
 
-    execDataPreprocessing(_inputs);
+        PadInputs(inputShapes);
+        UpdateOutputs();
+    }
 
     changeDefaultPtr();
 
@@ -210,6 +312,210 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+std::shared_ptr<MKLDNNPlugin::MKLDNNRequestsBatcher> MKLDNNPlugin::MKLDNNInferRequest::GetRequestsBatcher() const {
+    return execNetwork->_requestsBatcher;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::CanBeBatched() const {
+    if (m_curBatch > 0)
+        return false;
+    for (const auto& input : _inputs) {
+        // pre-processing writes to the blob allocated for the network input
+        if (_preProcData.find(input.first) != _preProcData.end())
+            continue;
+        const auto& networkDesc = _networkInputs.at(input.first)->getTensorDesc();
+        const auto& desc = input.second->getTensorDesc();
+        if (desc.getDims() != networkDesc.getDims() || desc.getPrecision() != networkDesc.getPrecision())
+            return false;
+        // the data of the blob with ANY layout is assumed to have the network input layout
+        if (desc.getLayout() != InferenceEngine::ANY && desc.getBlockingDesc() !=
+                InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), networkDesc.getLayout()).getBlockingDesc())
+            return false;
+    }
+    for (const auto& output : _outputs) {
+        if (output.second->getTensorDesc().getDims() != _networkOutputs.at(output.first)->getTensorDesc().getDims())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetBatchResult(std::exception_ptr exception) {
+    isInferredInBatch = true;
+    batchException = exception;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferOrTakeBatchResult() {
+    if (!isInferredInBatch) {
+        InferImpl();
+        return;
+    }
+
+    isInferredInBatch = false;
+    auto exception = batchException;
+    batchException = nullptr;
+    if (exception)
+        std::rethrow_exception(exception);
+    ThrowIfCanceled();
+}
+
+InferenceEngine::ITaskExecutor::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetPreprocessingExecutor() const {
+    return execNetwork->_preprocessingExecutor;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PreprocessInputs() {
+    areInputsPreprocessed = false;
+    ThrowIfCanceled();
+    execDataPreprocessing(_inputs);
+    areInputsPreprocessed = true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PushToBatch(InferenceEngine::BlobMap& batchedInputs, size_t index) {
+    const bool preprocessed = areInputsPreprocessed;
+    areInputsPreprocessed = false;
+
+    if (!preprocessed)
+        execDataPreprocessing(_inputs);
+
+    for (auto& input : batchedInputs) {
+        const auto& blob = _inputs.at(input.first);
+        const size_t itemSize = input.second->byteSize() / input.second->getTensorDesc().getDims()[0];
+        if (blob->byteSize() != itemSize)
+            IE_THROW() << "Input blob byte size is not equal network input byte size ("
+                               << blob->byteSize() << "!=" << itemSize << ").";
+        cpu_memcpy(input.second->buffer().as<uint8_t*>() + index * itemSize, blob->cbuffer().as<const uint8_t*>(), itemSize);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PullFromBatch(MKLDNNGraph& batchedGraph, size_t index) {
+    for (auto& node : batchedGraph.GetOutputNodes()) {
+        // remove out_ from node name
+        auto output = _outputs.find(node->getName().substr(4));
+        if (output == _outputs.end())
+            continue;
+
+        // the outermost dimension is the batch, so the output of the request is a consecutive part of the batched one
+        const auto& memory = node->getParentEdgeAt(0)->getMemory();
+        const size_t count = memory.GetElementsCount() / memory.GetDims()[0];
+        if (output->second->size() != count)
+            IE_THROW() << "Output blob number of elements is not equal network output number of elements ("
+                               << output->second->size() << "!=" << count << ").";
+
+        auto srcPrec = MKLDNNExtensionUtils::DataTypeToIEPrecision(memory.GetDataType());
+        auto dstPrec = output->second->getTensorDesc().getPrecision();
+        cpu_convert(static_cast<const uint8_t*>(memory.GetData()) + index * count * srcPrec.size(), output->second->buffer(),
+                    srcPrec, dstPrec, count);
+    }
+}
+
+std::map<std::string, InferenceEngine::SizeVector> MKLDNNPlugin::MKLDNNInferRequest::GetInputShapes() const {
+    std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+    for (const auto& input : _inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        const auto& networkDims = _networkInputs.at(input.first)->getTensorDesc().getDims();
+        if (dims.size() == networkDims.size()) {
+            for (size_t i = 0; i < dims.size(); i++) {
+                if (dims[i] == networkDims[i])
+                    continue;
+                auto bucket = std::lower_bound(shapeBuckets.begin(), shapeBuckets.end(), dims[i]);
+                if (bucket != shapeBuckets.end())
+                    dims[i] = *bucket;
+            }
+        }
+        inputShapes[input.first] = dims;
+    }
+    return inputShapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PadInputs(const std::map<std::string, InferenceEngine::SizeVector>& inputShapes) {
+    paddedInputs.clear();
+    for (const auto& input : _inputs) {
+        const auto& srcDesc = input.second->getTensorDesc();
+        const auto& dims = inputShapes.at(input.first);
+        if (srcDesc.getDims() == dims)
+            continue;
+
+        auto layout = srcDesc.getLayout() == InferenceEngine::ANY ? _networkInputs[input.first]->getLayout() : srcDesc.getLayout();
+        if (layout == InferenceEngine::BLOCKED || layout == InferenceEngine::ANY)
+            IE_THROW(NotImplemented) << "Padding of input blob " << input.first << " with blocked layout is not supported";
+
+        auto paddedBlob = make_blob_with_precision(InferenceEngine::TensorDesc(srcDesc.getPrecision(), dims, layout));
+        paddedBlob->allocate();
+        std::memset(paddedBlob->buffer().as<uint8_t*>(), 0, paddedBlob->byteSize());
+
+        // Both blobs have the same dimensions order, so the source data is copied row by row
+        const InferenceEngine::TensorDesc denseDesc(srcDesc.getPrecision(), srcDesc.getDims(), layout);
+        const auto srcBlockDims = denseDesc.getBlockingDesc().getBlockDims();
+        const auto srcStrides = srcDesc.getLayout() == InferenceEngine::ANY ? denseDesc.getBlockingDesc().getStrides()
+                                                                             : srcDesc.getBlockingDesc().getStrides();
+        const auto dstStrides = paddedBlob->getTensorDesc().getBlockingDesc().getStrides();
+        const size_t elementSize = srcDesc.getPrecision().size();
+        const size_t rank = srcBlockDims.size();
+        const size_t rowSize = rank ? srcBlockDims[rank - 1] * elementSize : elementSize;
+        const size_t rowsCount = rank ? input.second->size() / srcBlockDims[rank - 1] : 1;
+
+        auto srcData = input.second->cbuffer().as<const uint8_t*>() + srcDesc.getBlockingDesc().getOffsetPadding() * elementSize;
+        auto dstData = paddedBlob->buffer().as<uint8_t*>();
+        InferenceEngine::parallel_for(rowsCount, [&](size_t row) {
+            size_t srcOffset = 0, dstOffset = 0;
+            size_t rest = row;
+            for (int d = static_cast<int>(rank) - 2; d >= 0; d--) {
+                const size_t idx = rest % srcBlockDims[d];
+                rest /= srcBlockDims[d];
+                srcOffset += idx * srcStrides[d];
+                dstOffset += idx * dstStrides[d];
+            }
+            cpu_memcpy(dstData + dstOffset * elementSize, srcData + srcOffset * elementSize, rowSize);
+        });
+
+        paddedInputs[input.first] = paddedBlob;
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::UpdateOutputs() {
+    const size_t cacheSize = execNetwork->GetShapeCacheSize();
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (const auto& output : graphOutputs) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        auto& blob = _outputs[output.first];
+        if (blob && blob->getTensorDesc().getDims() == dims)
+            continue;
+
+        // Output shape depends on the input shapes. The blobs are kept for the network shape and as many other
+        // shapes as the network caches graphs for, so alternating shapes don't reallocate them
+        auto& blobs = shapeOutputs[output.first];
+        if (blob && blobs.empty())
+            blobs.emplace(blob->getTensorDesc().getDims(), blob);
+        auto found = blobs.find(dims);
+        if (found == blobs.end()) {
+            if (blobs.size() > cacheSize) {
+                releaseBlob(getShapeBlobName(output.first, blobs.begin()->first));
+                blobs.erase(blobs.begin());
+            }
+            auto precision = output.second->getTensorDesc().getPrecision();
+            found = blobs.emplace(dims, allocateBlob(getShapeBlobName(output.first, dims),
+                InferenceEngine::TensorDesc(precision, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)))).first;
+        }
+        blob = found->second;
+        externalPtr[output.first] = blob->buffer();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!execNetwork->IsShapeCacheEnabled()) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+
+    // Blobs of any shape are accepted, the graph is selected according to them
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -239,7 +545,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, execNetwork->IsShapeCacheEnabled() ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -253,8 +559,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
-        _inputs[name]->allocate();
+        _inputs[name] = allocateBlob(name, desc);
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
             externalPtr[name] = _inputs[name]->buffer();
@@ -268,7 +573,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, execNetwork->IsShapeCacheEnabled() ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -281,9 +586,9 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
         auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
         desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-        _outputs[name] = make_blob_with_precision(desc);
-        _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        _outputs[name] = allocateBlob(name, desc);
+        // the blob has the precision and the layout of the graph output, so the graph writes to it directly
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -332,20 +637,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
+            // Input blobs of other shapes are processed by graphs specialized for them
+            const bool isOtherShape = execNetwork->IsShapeCacheEnabled() &&
+                foundInput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size() &&
+                foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims();
+
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
                 : 1;
-            if (dataSize != inputSize) {
+            if (!isOtherShape && dataSize != inputSize) {
                 IE_THROW() << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+            if (!isOtherShape && foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
             }
 
             if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                (isOtherShape ? foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()
+                              : foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc())) {
                 IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
@@ -366,22 +677,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
+        const bool isOtherShape = execNetwork->IsShapeCacheEnabled() &&
+            foundOutput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size() &&
+            foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims();
+
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
-        if (dataSize != outputSize) {
+        if (!isOtherShape && dataSize != outputSize) {
             IE_THROW() << "Output blob size is not equal network output size ("
                                << dataSize << "!=" << outputSize << ").";
         }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+        if (!isOtherShape && foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
             IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
         }
         if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+            (isOtherShape ? foundOutput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()
+                          : foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc())) {
                 IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (isOutputCompatible(name, data->getTensorDesc()) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -390,6 +705,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isOutputCompatible(const std::string& name, const InferenceEngine::TensorDesc& desc) const {
+    for (auto& output : graph->GetOutputNodes()) {
+        if (output->getName() != "out_" + name)
+            continue;
+        // the user memory replaces the graph one only if the data can be used as is without conversion
+        auto graphDesc = output->getParentEdgeAt(0)->getDesc();
+        auto denseBlockingDesc = InferenceEngine::BlockingDesc(graphDesc.getBlockingDesc().getBlockDims(),
+                                                               graphDesc.getBlockingDesc().getOrder());
+        return graphDesc.getPrecision() == desc.getPrecision() && denseBlockingDesc == desc.getBlockingDesc();
+    }
+    return false;
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
@@ -398,6 +726,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
         if (input != graph->inputNodes.end()) {
+            // Padded copy of the user blob is pushed instead
+            if (paddedInputs.find(it.first) != paddedInputs.end())
+                continue;
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             // Input cannot be in-place with other primitives
@@ -441,15 +772,30 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
                 continue;
             bool canBeInPlace = true;
             void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+            // Edges reading the output tensor have their own memory objects with the same data pointer,
+            // so all of them are switched to the user memory together
+            std::vector<MKLDNNEdgePtr> aliases;
             // Cannot be in-place after concat because concat is using different ptrs without offsets
             auto parent = output->getParentEdgeAt(0)->getParent();
             MKLDNNNodePtr previousParent;
             do {
                 previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
+                if (parent->isConstant() || parent->isInplace()) {
                     canBeInPlace = false;
                     break;
                 }
+                for (size_t i = 0; canBeInPlace && i < parent->getChildEdges().size(); i++) {
+                    auto edge = parent->getChildEdgeAt(i);
+                    if (edge->getMemory().GetPrimitivePtr()->get_data_handle() != defaultPtr)
+                        continue;
+                    // Consumers which keep pointers with offsets into the tensor can't follow the new pointer
+                    auto& child = edge->getChild();
+                    auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+                    auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+                    if (child->isInplace() || (concat && concat->isOptimized()) || split)
+                        canBeInPlace = false;
+                    aliases.push_back(edge);
+                }
 
                 for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
                     if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
@@ -457,9 +803,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
                         break;
                     }
                 }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            } while (canBeInPlace && previousParent != parent);
+            for (size_t i = 0; canBeInPlace && i < aliases.size(); i++)
+                changeEdgePtr(aliases[i], it.second);
             continue;
         }
         IE_THROW() << "Cannot find input/output blob: " << it.first;
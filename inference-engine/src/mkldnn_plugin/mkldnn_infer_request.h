@@ -5,15 +5,18 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <exception>
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNRequestsBatcher;
 
 class MKLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
@@ -47,7 +50,57 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    void checkBlobs() override;
+
+    /**
+     * @brief NUMA node the blobs of the request are placed on and the inference is preferably run on
+     */
+    int GetNumaNodeId() const;
+
+    /**
+     * @brief Batcher which coalesces the request with the other ones, nullptr if automatic batching is disabled
+     */
+    std::shared_ptr<MKLDNNRequestsBatcher> GetRequestsBatcher() const;
+
+    /**
+     * @brief Returns true if the request can be inferred as a part of a batch: blobs have the network dimensions
+     * and are dense
+     */
+    bool CanBeBatched() const;
+
+    /**
+     * @brief Marks the request as inferred as a part of a batch
+     * @param exception The exception the batch inference failed with or nullptr
+     */
+    void SetBatchResult(std::exception_ptr exception);
+
+    /**
+     * @brief Infers the request unless it has been inferred as a part of a batch, in this case rethrows
+     * the exception of the batch inference if any
+     */
+    void InferOrTakeBatchResult();
+
+    /**
+     * @brief Executor running the input pre-processing as a separate stage of the asynchronous pipeline,
+     * nullptr if the pre-processing is a part of the inference
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetPreprocessingExecutor() const;
+
+    /**
+     * @brief Pre-processes the inputs, so the next inference of the request doesn't pre-process them itself.
+     * Inferences which aren't preceded by the call pre-process the inputs as usual
+     */
+    void PreprocessInputs();
+
 private:
+    std::map<std::string, InferenceEngine::SizeVector> GetInputShapes() const;
+    void PadInputs(const std::map<std::string, InferenceEngine::SizeVector>& inputShapes);
+    void UpdateOutputs();
+
+    friend class MKLDNNExecNetwork;
+    void PushToBatch(InferenceEngine::BlobMap& batchedInputs, size_t index);
+    void PullFromBatch(MKLDNNGraph& batchedGraph, size_t index);
+
     void PushInputData();
     void PushStates();
     void PullStates();
@@ -55,11 +108,27 @@ private:
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    bool isOutputCompatible(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+    InferenceEngine::Blob::Ptr allocateBlob(const std::string& name, const InferenceEngine::TensorDesc& desc);
+    void releaseBlob(const std::string& name);
+    std::string getShapeBlobName(const std::string& name, const InferenceEngine::SizeVector& dims) const;
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    std::shared_ptr<MKLDNNGraph>        specializedGraph;
+    std::vector<size_t>                 shapeBuckets;
+    InferenceEngine::BlobMap            paddedInputs;
+    // output blobs per output shape, reused when the request switches between the cached shapes
+    std::map<std::string, std::map<InferenceEngine::SizeVector, InferenceEngine::Blob::Ptr>> shapeOutputs;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    int                                 numaNodeId = -1;
+    std::shared_ptr<InferenceEngine::IAllocator> numaAllocator;
+    // sizes of the blobs allocated by the request, accounted in the network memory footprint
+    std::map<std::string, size_t>       allocatedBlobs;
+    bool                                isInferredInBatch = false;
+    std::exception_ptr                  batchException;
+    bool                                areInputsPreprocessed = false;
 };
 }  // namespace MKLDNNPlugin
@@ -18,6 +18,7 @@
 #include "mkldnn_extension_utils.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
+#include "utils/numa_utils.h"
 #include "ie_mkldnn.h"
 
 using namespace InferenceEngine;
@@ -89,6 +90,19 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+bool MKLDNNMemory::CreateOnNumaNode(const mkldnn::memory::desc& desc, int numaNodeId) {
+    auto storage = desc.data.format_kind == dnnl_format_kind_wino ? nullptr : allocateOnNumaNode(desc.get_size(), numaNodeId);
+    if (!storage) {
+        Create(desc);
+        return false;
+    }
+
+    // the mapping is zero filled, so the pads are zeroed already
+    Create(desc, storage.get(), false);
+    numaStorage = std::move(storage);
+    return true;
+}
+
 void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size) {
     if (size != 0)
         IE_ASSERT(size <= output.GetDescriptor().get_size());
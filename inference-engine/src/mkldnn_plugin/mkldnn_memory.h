@@ -150,6 +150,12 @@ public:
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
 
+    /**
+     * Allocates the memory from a separate mapping bound to the NUMA node, see allocateOnNumaNode()
+     * @return false if the binding isn't supported and the memory is allocated as usual
+     */
+    bool CreateOnNumaNode(const mkldnn::memory::desc& desc, int numaNodeId);
+
     // Like a plain format
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format_tag format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
@@ -168,6 +174,8 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    // the memory allocated on a NUMA node, the primitive refers to it as to the external one
+    std::shared_ptr<void> numaStorage;
     mkldnn::engine eng;
 };
 
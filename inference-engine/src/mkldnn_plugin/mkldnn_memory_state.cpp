@@ -6,6 +6,8 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <utility>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -15,15 +17,49 @@ std::string  MKLDNNVariableState::GetName() const {
 }
 
 void  MKLDNNVariableState::Reset() {
+    detachHeldStorage();
     std::memset(this->storage->buffer(), 0, storage->byteSize());
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
-    storage = newState;
+    if (newState == storage)
+        return;
+    if (newState->byteSize() != storage->byteSize())
+        IE_THROW() << "Cannot set state '" << name << "': the blob size " << newState->byteSize()
+                   << " doesn't match the state size " << storage->byteSize();
+
+    detachHeldStorage();
+    cpu_memcpy(storage->buffer(), newState->cbuffer(), storage->byteSize());
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
     return storage;
 }
 
+void MKLDNNVariableState::detachHeldStorage() {
+    if (storage.use_count() > 1) {
+        storage = make_blob_with_precision(storage->getTensorDesc());
+        storage->allocate();
+    }
+}
+
+InferenceEngine::Blob::CPtr MKLDNNVariableState::GetCurrentState() const {
+    return storage;
+}
+
+InferenceEngine::Blob::Ptr MKLDNNVariableState::GetNextState() {
+    if (!nextStorage) {
+        nextStorage = make_blob_with_precision(storage->getTensorDesc());
+        nextStorage->allocate();
+    }
+    return nextStorage;
+}
+
+void MKLDNNVariableState::CommitNextState() {
+    std::swap(storage, nextStorage);
+    // the previous state returned by GetState() must not be overwritten by the next inference
+    if (nextStorage.use_count() > 1)
+        nextStorage.reset();
+}
+
 }  // namespace MKLDNNPlugin
@@ -24,12 +24,41 @@ public:
 
     std::string GetName() const override;
     void Reset() override;
+    /**
+     * @brief Copies the new state to the buffer the next inference reads from
+     */
     void SetState(InferenceEngine::Blob::Ptr newState) override;
+    /**
+     * @brief Returns the buffer with the current state without copying it. The buffer held by the user
+     * isn't reused for the states of the next inferences, so the blob isn't changed by them.
+     */
     InferenceEngine::Blob::CPtr GetState() const override;
 
+    /**
+     * @brief Returns the buffer the inference reads the current state from
+     */
+    InferenceEngine::Blob::CPtr GetCurrentState() const;
+
+    /**
+     * @brief Returns the buffer the inference writes the next state to. The current state
+     * is read by the same inference, so the buffers are different.
+     */
+    InferenceEngine::Blob::Ptr GetNextState();
+
+    /**
+     * @brief Makes the next state current after the inference has written it
+     */
+    void CommitNextState();
+
 private:
+    /**
+     * @brief Replaces the current buffer by a new one if the user holds it
+     */
+    void detachHeldStorage();
+
     std::string name;
     InferenceEngine::Blob::Ptr storage;
+    InferenceEngine::Blob::Ptr nextStorage;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -46,6 +46,9 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_debug.h"
 #include "utils/rt_info/memory_formats_attribute.hpp"
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+#include <ie_ngraph_utils.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -57,9 +60,13 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "Unknown", Unknown },
         { "Input", Input },
         { "Const", Input },
+        { "Parameter", Input },
+        { "Constant", Input },
         { "Output", Output },
+        { "Result", Output },
         { "Reorder", Reorder },
         { "Convolution", Convolution },
+        { "ConvolutionIE", Convolution },
         { "ReLU", Eltwise },
         { "GELU", Eltwise },
         { "ELU", Eltwise },
@@ -81,6 +88,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "Norm", Lrn },
         { "LRN", Lrn },
         { "Pooling", Pooling },
+        { "MaxPool", Pooling },
+        { "AvgPool", Pooling },
         { "FullyConnected", FullyConnected },
         { "InnerProduct", FullyConnected },
         { "Gemm", Gemm },
@@ -137,6 +146,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string type) {
@@ -155,6 +165,11 @@ MKLDNNNode::NodesFactory & MKLDNNNode::factory() {
     return factoryInstance;
 }
 
+MKLDNNNode::NgraphNodesFactory & MKLDNNNode::ngraphFactory() {
+    static NgraphNodesFactory factoryInstance;
+    return factoryInstance;
+}
+
 MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
         MKLDNNWeightsSharing::Ptr &w_cache)
         : selectedPrimitiveDescriptorIndex(-1), permanent(false), temporary(false), constant(ConstantType::Unknown),
@@ -163,6 +178,7 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
     if (!layer->outData.empty()) {
         for (const auto& outData : layer->outData) {
             outDims.emplace_back(outData->getDims());
+            originalOutputPrecisions.push_back(outData->getPrecision());
         }
     } else {
         if (!(CaselessEq<std::string>()(layer->type, "memory") ||
@@ -176,46 +192,102 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
 
     for (const auto& inData : layer->insData) {
         inDims.emplace_back(inData.lock()->getDims());
+        originalInputPrecisions.push_back(inData.lock()->getPrecision());
     }
     if (layer->params.find("PrimitivesPriority") != layer->params.end()) {
-        std::istringstream stream(layer->params["PrimitivesPriority"]);
+        parsePrimitivesPriority(layer->params["PrimitivesPriority"]);
+    }
+
+    auto ngraphNode = layer->getNode();
+    if (ngraphNode != nullptr) {
+        parseMemoryFormats(ngraphNode);
+    }
+}
+
+MKLDNNNode::MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &w_cache)
+        : selectedPrimitiveDescriptorIndex(-1), permanent(false), temporary(false), constant(ConstantType::Unknown),
+          weightCache(w_cache), engine(eng), name(op->get_friendly_name()), typeStr(op->get_type_name()),
+          type(TypeFromName(op->get_type_name())), profiling(op->get_friendly_name()) {
+    for (size_t i = 0; i < op->get_input_size(); i++) {
+        inDims.emplace_back(op->get_input_shape(i));
+        originalInputPrecisions.push_back(InferenceEngine::details::convertPrecision(op->get_input_element_type(i)));
+    }
+    for (size_t i = 0; i < op->get_output_size(); i++) {
+        outDims.emplace_back(op->get_output_shape(i));
+        originalOutputPrecisions.push_back(InferenceEngine::details::convertPrecision(op->get_output_element_type(i)));
+    }
+
+    originalLayers = ngraph::getFusedNames(op);
+
+    std::string primitivesPriority = ngraph::getPrimitivesPriority(op);
+    if (!primitivesPriority.empty()) {
+        parsePrimitivesPriority(primitivesPriority);
+    }
+    parseMemoryFormats(op);
+}
+
+void MKLDNNNode::parsePrimitivesPriority(const std::string& priorities) {
+    std::istringstream stream(priorities);
+    std::string str;
+    while (getline(stream, str, ',')) {
+        if (str.substr(0, 4) != "cpu:")
+            continue;
+        implPriorities.push_back(parse_impl_name(str));
+        if (implPriorities[implPriorities.size() - 1] == impl_desc_type::unknown &&
+                str != "cpu:unknown")
+            IE_THROW() << "Unsupported CPU implementation " << str << " for node " << getName();
+    }
+}
+
+void MKLDNNNode::parseMemoryFormats(const std::shared_ptr<ngraph::Node>& op) {
+    std::string inputMemoryFormats = ngraph::getMLKDNNInputMemoryFormats(op);
+    if (!inputMemoryFormats.empty()) {
+        std::istringstream stream(inputMemoryFormats);
         std::string str;
         while (getline(stream, str, ',')) {
             if (str.substr(0, 4) != "cpu:")
                 continue;
-            implPriorities.push_back(parse_impl_name(str));
-            if (implPriorities[implPriorities.size() - 1] == impl_desc_type::unknown &&
-                    str != "cpu:unknown")
-                IE_THROW() << "Unsupported CPU implementation " << str << " for node " << getName();
+            inputMemoryFormatsFilter.push_back(mkldnn::utils::str2fmt(str.substr(4, str.size()).c_str()));
         }
     }
 
-    auto ngraphNode = layer->getNode();
-    if (ngraphNode != nullptr) {
-        std::string inputMemoryFormats = ngraph::getMLKDNNInputMemoryFormats(ngraphNode);
-        if (!inputMemoryFormats.empty()) {
-            std::istringstream stream(inputMemoryFormats);
-            std::string str;
-            while (getline(stream, str, ',')) {
-                if (str.substr(0, 4) != "cpu:")
-                    continue;
-                inputMemoryFormatsFilter.push_back(mkldnn::utils::str2fmt(str.substr(4, str.size()).c_str()));
-            }
-        }
-
-        std::string outputMemoryFormats = ngraph::getMLKDNNOutputMemoryFormats(ngraphNode);
-        if (!outputMemoryFormats.empty()) {
-            std::istringstream stream(outputMemoryFormats);
-            std::string str;
-            while (getline(stream, str, ',')) {
-                if (str.substr(0, 4) != "cpu:")
-                    continue;
-                outputMemoryFormatsFilter.push_back(mkldnn::utils::str2fmt(str.substr(4, str.size()).c_str()));
-            }
+    std::string outputMemoryFormats = ngraph::getMLKDNNOutputMemoryFormats(op);
+    if (!outputMemoryFormats.empty()) {
+        std::istringstream stream(outputMemoryFormats);
+        std::string str;
+        while (getline(stream, str, ',')) {
+            if (str.substr(0, 4) != "cpu:")
+                continue;
+            outputMemoryFormatsFilter.push_back(mkldnn::utils::str2fmt(str.substr(4, str.size()).c_str()));
         }
     }
 }
 
+InferenceEngine::Precision MKLDNNNode::getOriginalInputPrecisionAtPort(size_t port) const {
+    if (port >= originalInputPrecisions.size())
+        IE_THROW() << "Incorrect input port " << port << " for node " << getName();
+    return originalInputPrecisions[port];
+}
+
+InferenceEngine::Precision MKLDNNNode::getOriginalOutputPrecisionAtPort(size_t port) const {
+    if (port >= originalOutputPrecisions.size())
+        IE_THROW() << "Incorrect output port " << port << " for node " << getName();
+    return originalOutputPrecisions[port];
+}
+
+void MKLDNNNode::setOriginalInputPrecisionAtPort(size_t port, InferenceEngine::Precision precision) {
+    if (port >= originalInputPrecisions.size())
+        IE_THROW() << "Incorrect input port " << port << " for node " << getName();
+    originalInputPrecisions[port] = precision;
+}
+
+void MKLDNNNode::setOriginalOutputPrecisionAtPort(size_t port, InferenceEngine::Precision precision) {
+    if (port >= originalOutputPrecisions.size())
+        IE_THROW() << "Incorrect output port " << port << " for node " << getName();
+    originalOutputPrecisions[port] = precision;
+}
+
 void MKLDNNNode::addEdge(const MKLDNNEdgeWeakPtr& edge) {
     auto edgePtr = edge.lock();
     if (!edgePtr)
@@ -751,7 +823,10 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             memory.Create(newDesc, internalBlob->buffer());
 
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
+            if (weightCache != nullptr)
+                _ptr->CreateOnNumaNode(intDescs[i], weightCache->GetNumaNodeId());
+            else
+                _ptr->Create(intDescs[i]);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -762,9 +837,18 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
+            // Graphs specialized for different input shapes may select different weights layouts for the same node
+            const InferenceEngine::TensorDesc intDesc = intDescs[i];
+            std::string layout;
+            for (auto dim : intDesc.getBlockingDesc().getBlockDims())
+                layout += std::to_string(dim) + ",";
+            for (auto order : intDesc.getBlockingDesc().getOrder())
+                layout += std::to_string(order) + ",";
+
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+                                            + "_" + std::to_string(data_hash)
+                                            + "_" + layout;
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
@@ -1204,3 +1288,24 @@ MKLDNNNode* MKLDNNNode::NodesFactory::create(const InferenceEngine::CNNLayerPtr&
 
     return newNode;
 }
+
+bool MKLDNNNode::NgraphNodesFactory::isSupported(const std::shared_ptr<const ngraph::Node>& op) const {
+    const auto type = TypeFromName(op->get_type_name());
+    if (type == Unknown)
+        return false;
+
+    bool registered = false;
+    foreach([&](const std::pair<const Type, builder_t>& builder) {
+        registered = registered || builder.first == type;
+    });
+    return registered;
+}
+
+MKLDNNNode* MKLDNNNode::NgraphNodesFactory::create(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                   MKLDNNWeightsSharing::Ptr &w_cache) {
+    std::unique_ptr<MKLDNNNode> newNode(createNodeIfRegistered(MKLDNNPlugin, TypeFromName(op->get_type_name()), op, eng, w_cache));
+    if (newNode == nullptr || !newNode->created())
+        IE_THROW() << "Unsupported operation of type: " << op->get_type_name() << " name: " << op->get_friendly_name();
+
+    return newNode.release();
+}
@@ -85,7 +85,8 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Subgraph
 };
 
 Type TypeFromName(const std::string type);
@@ -200,6 +201,8 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -298,6 +301,9 @@ public:
     class NodesFactory;
     static NodesFactory & factory();
 
+    class NgraphNodesFactory;
+    static NgraphNodesFactory & ngraphFactory();
+
     ~MKLDNNNode() override = default;
 
     void addEdge(const MKLDNNEdgeWeakPtr& edge);
@@ -368,10 +374,31 @@ public:
         return type;
     }
 
+    /**
+     * @brief Returns the legacy layer the node was created from
+     * @return Pointer to the layer or nullptr if the node was created directly from an ngraph operation
+     */
     const InferenceEngine::CNNLayerPtr &getCnnLayer() const {
         return cnnLayer;
     }
 
+    /**
+     * @brief Returns precision of the input port from the original network, it's known before edges are initialized
+     * @param port Input port index
+     * @return Precision of the data connected to the port
+     */
+    InferenceEngine::Precision getOriginalInputPrecisionAtPort(size_t port) const;
+
+    /**
+     * @brief Returns precision of the output port from the original network, it's known before edges are initialized
+     * @param port Output port index
+     * @return Precision of the data produced on the port
+     */
+    InferenceEngine::Precision getOriginalOutputPrecisionAtPort(size_t port) const;
+
+    void setOriginalInputPrecisionAtPort(size_t port, InferenceEngine::Precision precision);
+    void setOriginalOutputPrecisionAtPort(size_t port, InferenceEngine::Precision precision);
+
     const std::vector<PrimitiveDescInfo>& getSupportedPrimitiveDescriptors() const {
         return supportedPrimitiveDescriptors;
     }
@@ -559,6 +586,10 @@ protected:
     std::string originalLayers;  // contains names of the original layers separated by comma
 
     MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
+    MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
+
+    std::vector<InferenceEngine::Precision> originalInputPrecisions;
+    std::vector<InferenceEngine::Precision> originalOutputPrecisions;
 
     int selectedPrimitiveDescriptorIndex = -1;
     bool permanent = false;
@@ -645,6 +676,8 @@ private:
     }
 
     void prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd);
+    void parsePrimitivesPriority(const std::string& priorities);
+    void parseMemoryFormats(const std::shared_ptr<ngraph::Node>& op);
     enum LOOK { LOOK_UP = 1, LOOK_DOWN = 2 };
     ConstantType checkConstant(LOOK look, std::vector<MKLDNNNodePtr>& checkNodes);
 };
@@ -661,12 +694,34 @@ public:
                        const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache);
 };
 
+/**
+ * @brief Creates nodes directly from ngraph operations, so the graph can be built without the conversion to CNNNetwork.
+ * Only the node types registered with REG_MKLDNN_PRIM_FOR_NGRAPH can be created this way.
+ */
+class MKLDNNNode::NgraphNodesFactory : public openvino::cc::Factory<Type,
+                                            MKLDNNNode*(const std::shared_ptr<ngraph::Node>&,
+                                                        const mkldnn::engine &,
+                                                        MKLDNNWeightsSharing::Ptr &)> {
+public:
+    NgraphNodesFactory()
+        : Factory("NgraphNodesFactory") {}
+
+    bool isSupported(const std::shared_ptr<const ngraph::Node>& op) const;
+
+    MKLDNNNode* create(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
+};
+
 template<typename MKLDNNNodeType>
 struct MKLDNNNodeImpl : public MKLDNNNodeType {
     MKLDNNNodeImpl(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNodeType(layer, eng, cache) {
         MKLDNNNodeType::perfCounters().template buildClassCounters<MKLDNNNodeType>(NameFromType(MKLDNNNodeType::getType()));
     }
+
+    MKLDNNNodeImpl(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNodeType(op, eng, cache) {
+        MKLDNNNodeType::perfCounters().template buildClassCounters<MKLDNNNodeType>(NameFromType(MKLDNNNodeType::getType()));
+    }
 };
 
 #define REG_MKLDNN_CONCAT3_(X, Y, Z) X ## Y ## Z
@@ -680,4 +735,12 @@ static struct REG_MKLDNN_CONCAT3(Registrar4, __prim, __LINE__) {
     }                                                                                       \
 } REG_MKLDNN_CONCAT3(_reg_, __prim, __LINE__);
 
+#define REG_MKLDNN_PRIM_FOR_NGRAPH(__prim, __type)                                          \
+static struct REG_MKLDNN_CONCAT3(NgraphRegistrar4, __prim, __LINE__) {                      \
+    REG_MKLDNN_CONCAT3(NgraphRegistrar4, __prim, __LINE__)() {                              \
+        MKLDNNNode::ngraphFactory()                                                         \
+            .registerNodeIfRequired(MKLDNNPlugin, __prim, __type, MKLDNNNodeImpl<__prim>);  \
+    }                                                                                       \
+} REG_MKLDNN_CONCAT3(_ngraph_reg_, __prim, __LINE__);
+
 }  // namespace MKLDNNPlugin
@@ -7,6 +7,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -15,6 +16,7 @@
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
 #include <nodes/list.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
@@ -70,7 +72,9 @@
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <ngraph/graph_util.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -84,7 +88,9 @@
 #include <low_precision/network_helper.hpp>
 
 #include "nodes/mkldnn_mvn_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "nodes/mkldnn_snippet_node.h"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -109,9 +115,33 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
-    auto nGraphFunc = clonedNetwork.getFunction();
+static const std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
+        {ngraph::element::i64,     ngraph::element::i32},
+        {ngraph::element::u64,     ngraph::element::i32},
+        {ngraph::element::i16,     ngraph::element::i32},
+        {ngraph::element::u16,     ngraph::element::i32},
+        {ngraph::element::u32,     ngraph::element::i32},
+        {ngraph::element::f64,     ngraph::element::f32},
+        {ngraph::element::f16,     ngraph::element::f32},
+        {ngraph::element::boolean, ngraph::element::u8},
+};
+
+// Replaces the subgraphs which the kernel can't be generated for with the operations of their bodies
+static void UnfoldUnsupportedSnippets(const std::shared_ptr<ngraph::Function>& nGraphFunc) {
+    for (const auto& op : nGraphFunc->get_ordered_ops()) {
+        auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph || MKLDNNSnippetNode::isSupported(subgraph))
+            continue;
+
+        auto body = ngraph::clone_function(*subgraph->get_body());
+        for (size_t i = 0; i < body->get_parameters().size(); i++)
+            body->get_parameters()[i]->output(0).replace(subgraph->input_value(i));
+        for (size_t i = 0; i < body->get_results().size(); i++)
+            subgraph->output(i).replace(body->get_results()[i]->input_value(0));
+    }
+}
 
+static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const Config& conf) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
 
@@ -123,10 +153,20 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8 });
     }
 
+    // Compressed weights are kept in their original precision before the 1st ConstantFolding pass decompresses them
+    const bool keepWeightsCompressed = conf.weightsCompression && !useLpt &&
+        MKLDNNFullyConnectedNode::isWeightsDecompressionSupported();
+    if (keepWeightsCompressed) {
+        manager.register_pass<ngraph::pass::WeightsDequantizeToFakeQuantize>(true);
+    }
+
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::ConvertPriorBox>();
     manager.register_pass<ngraph::pass::ConvertNMS5ToLegacyMatcher>();
-    manager.register_pass<ngraph::pass::CommonOptimizations>();
+    // the independent parts of the common optimizations share the threads of the plugin
+    manager.register_pass<ngraph::pass::CommonOptimizations>([](size_t count, const std::function<void(size_t)>& func) {
+        InferenceEngine::parallel_for(count, func);
+    });
     manager.register_pass<ngraph::pass::ConvertRNNSequenceToTensorIterator>();
     manager.register_pass<ngraph::pass::ConvertGRUSequenceToTensorIterator>();
     manager.register_pass<ngraph::pass::ConvertLSTMSequenceToTensorIterator>();
@@ -139,17 +179,6 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::GRUCellDecomposition>();
     manager.register_pass<ngraph::pass::RNNCellDecomposition>();
 
-    std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
-            {ngraph::element::i64,     ngraph::element::i32},
-            {ngraph::element::u64,     ngraph::element::i32},
-            {ngraph::element::i16,     ngraph::element::i32},
-            {ngraph::element::u16,     ngraph::element::i32},
-            {ngraph::element::u32,     ngraph::element::i32},
-            {ngraph::element::f64,     ngraph::element::f32},
-            {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-    };
-
     for (auto &precision : convert_precision_list) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
@@ -269,7 +298,18 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     pass_config->disable<ngraph::pass::ConvertMod>();
     pass_config->disable<ngraph::pass::LogSoftmaxDecomposition>();
     pass_config->disable<ngraph::pass::ConvertInterpolateToInterpOrResampleMatcher>();
-    pass_config->disable<ngraph::pass::WeightsDequantizeToFakeQuantize>();
+    if (keepWeightsCompressed) {
+        // only 2D weights of MatMul operations which become FullyConnected ones are decompressed by the kernel
+        pass_config->set_callback<ngraph::pass::WeightsDequantizeToFakeQuantize>(
+                [](const_node_ptr &node) -> bool {
+                    const auto consumers = node->get_output_target_inputs(0);
+                    return consumers.size() != 1 || consumers.begin()->get_index() != 1 ||
+                           !ngraph::is_type<ngraph::opset1::MatMul>(consumers.begin()->get_node()) ||
+                           node->get_output_partial_shape(0).rank() != 2;
+                });
+    } else {
+        pass_config->disable<ngraph::pass::WeightsDequantizeToFakeQuantize>();
+    }
     pass_config->disable<ngraph::pass::SimplifyCTCGreedyDecoderSeqLen>();
 
     pass_config->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
@@ -314,6 +354,22 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         transformer.transform(nGraphFunc);
     }
 
+    if (conf.snippets) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "TokenizeSnippets");
+
+        // elementwise chains are collapsed before the conversion to the legacy opset which decomposes them to layers
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        snippetsManager.run_passes(nGraphFunc);
+        UnfoldUnsupportedSnippets(nGraphFunc);
+    }
+}
+
+static void ConvertToCPUSpecificOpset(CNNNetwork& clonedNetwork, const Config& conf) {
+    auto nGraphFunc = clonedNetwork.getFunction();
+
+    using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
+
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
     ngraph::pass::Manager legacyManager;
@@ -351,7 +407,29 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     legacyManager.run_passes(nGraphFunc);
 
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "Transformation", "convertFunctionToICNNNetwork");
+    // The graph is built from the function directly if nodes of all its operations can be created from ngraph.
+    // Dynamic batch, the shape cache, automatic batching and BF16 enforcement are implemented on top of CNNNetwork,
+    // so they require the conversion.
+    if (conf.batchLimit == 0 && conf.shapeCacheSize == 0 && conf.autoBatchSize <= 1 && !conf.enforceBF16 &&
+        MKLDNNGraph::CanReplicate(nGraphFunc)) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "ConvertIOPrecision");
+        auto convertIOPrecision = [](Precision precision) {
+            for (auto & convert : convert_precision_list) {
+                if (precision == InferenceEngine::details::convertPrecision(convert.first))
+                    return InferenceEngine::details::convertPrecision(convert.second);
+            }
+            return precision;
+        };
+        for (auto & input : clonedNetwork.getInputsInfo()) {
+            input.second->setPrecision(convertIOPrecision(input.second->getPrecision()));
+        }
+        for (auto & output : clonedNetwork.getOutputsInfo()) {
+            output.second->setPrecision(convertIOPrecision(output.second->getPrecision()));
+        }
+        return;
+    }
+
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "ConvertToCPUSpecificOpset", "convertFunctionToICNNNetwork");
 
     clonedNetwork = CNNNetwork(InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, clonedNetwork, has_fake_quantize));
 
@@ -370,6 +448,31 @@ InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
 
+    return CompileNetwork(network, config, false);
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    bool areCommonTransformationsApplied = false;
+    auto network = DeserializeNetwork(networkModel, *GetCore(), areCommonTransformationsApplied);
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(network.getInputsInfo(), network.getOutputsInfo(), networkInputs, networkOutputs);
+
+    auto execNetwork = CompileNetwork(network, config, areCommonTransformationsApplied);
+    execNetwork->setNetworkInputs(networkInputs);
+    execNetwork->setNetworkOutputs(networkOutputs);
+    execNetwork->SetPointerToPlugin(shared_from_this());
+
+    return make_executable_network(execNetwork);
+}
+
+InferenceEngine::ExecutableNetworkInternal::Ptr
+Engine::CompileNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                       bool areCommonTransformationsApplied) {
     // verification of supported input
     InferenceEngine::InputsDataMap _networkInputs = network.getInputsInfo();
     for (const auto &ii : _networkInputs) {
@@ -401,10 +504,30 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
 
-    bool is_transformed = false;
-    if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
+    // Function which is written on Export. The clone of the original function shares the constants with it,
+    // while the folded and converted constants are created again on Export, so they aren't kept in memory
+    // for the networks which are never exported. If the function can't be read back as IR v10 after
+    // common transformations, the original function is written, so the transformations are repeated on Import.
+    MKLDNNExecNetwork::ExportedFunctionProvider exportedFunctionProvider;
+
+    bool isConvertedToCPUOpset = false;
+    if (auto nGraphFunc = clonedNetwork.getFunction()) {
+        auto originalFunction = ngraph::clone_function(*nGraphFunc);
+        auto extMgr = extensionManager;
+        exportedFunctionProvider = [originalFunction, areCommonTransformationsApplied, conf, extMgr] () {
+            if (areCommonTransformationsApplied)
+                return std::make_pair(originalFunction, true);
+            auto transformedFunction = ngraph::clone_function(*originalFunction);
+            TransformationUpToCPUSpecificOpSet(transformedFunction, conf);
+            if (IsSerializableFunction(transformedFunction, extMgr->GetOpSets()))
+                return std::make_pair(transformedFunction, true);
+            return std::make_pair(originalFunction, false);
+        };
+
+        if (!areCommonTransformationsApplied)
+            TransformationUpToCPUSpecificOpSet(nGraphFunc, conf);
+        ConvertToCPUSpecificOpset(clonedNetwork, conf);
+        isConvertedToCPUOpset = true;
     }
     IE_SUPPRESS_DEPRECATED_START
     auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
@@ -415,7 +538,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
-        if (!is_transformed) {
+        if (!isConvertedToCPUOpset) {
             InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
             NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
             NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
@@ -428,7 +551,29 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    // Graphs for other input shapes and batches are created from the original function,
+    // because common transformations fold subgraphs which depend on input shapes
+    MKLDNNExecNetwork::NetworkReshaper networkReshaper;
+    if ((conf.shapeCacheSize > 0 || conf.autoBatchSize > 1) && network.getFunction() && !areCommonTransformationsApplied) {
+        CNNNetwork originalNetwork = InferenceEngine::cloneNetwork(network);
+        networkReshaper = [originalNetwork, conf] (const MKLDNNExecNetwork::InputShapes& inputShapes) {
+            CNNNetwork reshapedNetwork = InferenceEngine::cloneNetwork(originalNetwork);
+            reshapedNetwork.reshape(inputShapes);
+            TransformationUpToCPUSpecificOpSet(reshapedNetwork.getFunction(), conf);
+            ConvertToCPUSpecificOpset(reshapedNetwork, conf);
+            IE_SUPPRESS_DEPRECATED_START
+            auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(static_cast<ICNNNetwork::Ptr>(reshapedNetwork));
+            IE_SUPPRESS_DEPRECATED_END
+            if (implNetwork) {
+                ConstTransformer transformator(implNetwork.get());
+                transformator.fullTrim();
+            }
+            return reshapedNetwork;
+        };
+    }
+
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing,
+                                               exportedFunctionProvider, networkReshaper);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -471,6 +616,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -517,6 +663,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -25,6 +25,9 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork
+    ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -37,6 +40,10 @@ public:
                                                      const std::map<std::string, std::string>& config) const override;
 
 private:
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    CompileNetwork(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config,
+                   bool areCommonTransformationsApplied);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_requests_batcher.h"
+#include "mkldnn_infer_request.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+
+MKLDNNRequestsBatcher::MKLDNNRequestsBatcher(const InferenceEngine::ITaskExecutor::Ptr& executor, size_t maxBatch,
+                                             std::chrono::microseconds timeout, const BatchInfer& batchInfer)
+    : _executor(executor)
+    , _maxBatch(std::max<size_t>(maxBatch, 1))
+    , _timeout(timeout)
+    , _batchInfer(batchInfer)
+    , _isEnabled(std::make_shared<std::atomic_bool>(true)) {
+    _thread = std::thread([this] {Run();});
+}
+
+MKLDNNRequestsBatcher::~MKLDNNRequestsBatcher() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _isStopped = true;
+    }
+    _queueCondVar.notify_one();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool MKLDNNRequestsBatcher::Enqueue(MKLDNNInferRequest* request, InferenceEngine::Task& task) {
+    if (!*_isEnabled || !request->CanBeBatched())
+        return false;
+
+    size_t queueSize = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _queue.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+        queueSize = _queue.size();
+    }
+    // the thread is woken up to start the timeout or to dispatch the full batch
+    if (queueSize == 1 || queueSize >= _maxBatch)
+        _queueCondVar.notify_one();
+    return true;
+}
+
+void MKLDNNRequestsBatcher::Run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (!_isStopped || !_queue.empty()) {
+        if (_queue.empty()) {
+            _queueCondVar.wait(lock, [&] {return _isStopped || !_queue.empty();});
+            continue;
+        }
+        // returns when the batch is full or the oldest request has been held for the timeout
+        _queueCondVar.wait_until(lock, _queue.front()._startTime + _timeout,
+                                 [&] {return _isStopped || _queue.size() >= _maxBatch;});
+
+        std::vector<HeldRequest> requests;
+        const size_t batch = std::min(_queue.size(), _maxBatch);
+        requests.reserve(batch);
+        for (size_t i = 0; i < batch; i++) {
+            requests.push_back(std::move(_queue.front()));
+            _queue.pop_front();
+        }
+        lock.unlock();
+        Dispatch(std::move(requests));
+        lock.lock();
+    }
+}
+
+void MKLDNNRequestsBatcher::Dispatch(std::vector<HeldRequest> requests) {
+    // The batcher may be destroyed as soon as the tasks of the requests complete, so only copies are used
+    auto executor = _executor;
+    auto batchInfer = _batchInfer;
+    auto isEnabled = _isEnabled;
+    auto heldRequests = std::make_shared<std::vector<HeldRequest>>(std::move(requests));
+    _executor->run([executor, batchInfer, isEnabled, heldRequests] {
+        std::vector<MKLDNNInferRequest*> inferRequests;
+        for (auto& heldRequest : *heldRequests)
+            inferRequests.push_back(heldRequest._request);
+
+        bool isInferred = false;
+        std::exception_ptr exception;
+        if (inferRequests.size() > 1) {
+            try {
+                isInferred = batchInfer(inferRequests);
+                if (!isInferred)
+                    *isEnabled = false;
+            } catch (...) {
+                isInferred = true;
+                exception = std::current_exception();
+            }
+        }
+
+        // Tasks complete the pipeline stages of the requests. The requests which weren't inferred in the batch are
+        // inferred by the tasks themselves, so they are distributed between the streams again
+        for (auto& heldRequest : *heldRequests) {
+            if (isInferred) {
+                heldRequest._request->SetBatchResult(exception);
+                heldRequest._task();
+            } else if (heldRequests->size() == 1) {
+                heldRequest._task();
+            } else {
+                executor->run(std::move(heldRequest._task));
+            }
+        }
+    });
+}
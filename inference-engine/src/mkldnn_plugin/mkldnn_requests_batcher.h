@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_itask_executor.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNInferRequest;
+
+/**
+ * Coalesces infer requests started concurrently into one inference. A request is held until the maximum batch is
+ * collected or the timeout counted from the start of the oldest held request expires, then all the held requests
+ * are passed to the batch inference function on the task executor.
+ */
+class MKLDNNRequestsBatcher {
+public:
+    typedef std::shared_ptr<MKLDNNRequestsBatcher> Ptr;
+    /**
+     * Infers the requests as one batch. Returns false if the batch can't be inferred, so the requests are inferred
+     * one by one
+     */
+    typedef std::function<bool(const std::vector<MKLDNNInferRequest*>&)> BatchInfer;
+
+    MKLDNNRequestsBatcher(const InferenceEngine::ITaskExecutor::Ptr& executor, size_t maxBatch,
+                          std::chrono::microseconds timeout, const BatchInfer& batchInfer);
+
+    ~MKLDNNRequestsBatcher();
+
+    /**
+     * Holds the request and runs the task on the executor after the batch the request is added to is inferred.
+     * Returns false and leaves the task untouched if the request can't be batched.
+     */
+    bool Enqueue(MKLDNNInferRequest* request, InferenceEngine::Task& task);
+
+    size_t GetMaxBatch() const {
+        return _maxBatch;
+    }
+
+private:
+    struct HeldRequest {
+        MKLDNNInferRequest*                     _request;
+        InferenceEngine::Task                   _task;
+        std::chrono::steady_clock::time_point   _startTime;
+    };
+
+    void Run();
+    void Dispatch(std::vector<HeldRequest> requests);
+
+    InferenceEngine::ITaskExecutor::Ptr _executor;
+    size_t                              _maxBatch;
+    std::chrono::microseconds           _timeout;
+    BatchInfer                          _batchInfer;
+    // cleared when the network can't be inferred in batches, so requests aren't held anymore
+    std::shared_ptr<std::atomic_bool>   _isEnabled;
+    std::mutex                          _mutex;
+    std::condition_variable             _queueCondVar;
+    std::deque<HeldRequest>             _queue;
+    bool                                _isStopped = false;
+    std::thread                         _thread;
+};
+
+}  // namespace MKLDNNPlugin
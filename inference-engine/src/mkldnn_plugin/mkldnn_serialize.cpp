@@ -0,0 +1,218 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <ie_blob.h>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <transformations/serialize.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// Runtime info which either survives IR v10 serialization or doesn't affect the CPU specific conversion steps
+const std::vector<std::string> serializableRtInfo = {
+    "PrimitivesPriority",
+    "alt_width",
+    ngraph::VariantWrapper<ngraph::FusedNames>::type_info.name,
+};
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write(std::ostream& stream, const std::string& value) {
+    write(stream, static_cast<std::uint64_t>(value.size()));
+    stream.write(value.c_str(), value.size());
+}
+
+template <typename T>
+T read(std::istream& stream) {
+    T value {};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network";
+    return value;
+}
+
+std::string readString(std::istream& stream) {
+    std::string value(static_cast<size_t>(read<std::uint64_t>(stream)), '\0');
+    stream.read(&value[0], value.size());
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the exported CPU network";
+    return value;
+}
+
+void writePreProcess(std::ostream& stream, const PreProcessInfo& preProcess) {
+    write(stream, static_cast<std::int32_t>(preProcess.getResizeAlgorithm()));
+    write(stream, static_cast<std::int32_t>(preProcess.getColorFormat()));
+    write(stream, static_cast<std::int32_t>(preProcess.getMeanVariant()));
+    write(stream, static_cast<std::uint64_t>(preProcess.getNumberOfChannels()));
+    for (size_t ch = 0; ch < preProcess.getNumberOfChannels(); ch++) {
+        const auto& channel = preProcess[ch];
+        write(stream, channel->meanValue);
+        write(stream, channel->stdScale);
+        const bool hasMeanData = static_cast<bool>(channel->meanData);
+        write(stream, hasMeanData);
+        if (hasMeanData) {
+            const auto& dims = channel->meanData->getTensorDesc().getDims();
+            write(stream, static_cast<std::uint64_t>(dims.size()));
+            for (auto dim : dims)
+                write(stream, static_cast<std::uint64_t>(dim));
+            stream.write(channel->meanData->cbuffer().as<const char*>(), channel->meanData->byteSize());
+        }
+    }
+}
+
+void readPreProcess(std::istream& stream, PreProcessInfo& preProcess) {
+    preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(read<std::int32_t>(stream)));
+    preProcess.setColorFormat(static_cast<ColorFormat>(read<std::int32_t>(stream)));
+    const auto variant = static_cast<MeanVariant>(read<std::int32_t>(stream));
+    const auto channels = static_cast<size_t>(read<std::uint64_t>(stream));
+    if (channels != 0)
+        preProcess.init(channels);
+    for (size_t ch = 0; ch < channels; ch++) {
+        auto& channel = preProcess[ch];
+        channel->meanValue = read<float>(stream);
+        channel->stdScale = read<float>(stream);
+        if (read<bool>(stream)) {
+            SizeVector dims(static_cast<size_t>(read<std::uint64_t>(stream)));
+            for (auto& dim : dims)
+                dim = static_cast<size_t>(read<std::uint64_t>(stream));
+            auto meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)));
+            meanData->allocate();
+            stream.read(meanData->buffer().as<char*>(), meanData->byteSize());
+            channel->meanData = meanData;
+        }
+    }
+    preProcess.setVariant(variant);
+}
+
+bool isSerializableOp(const std::shared_ptr<const ngraph::Node>& op,
+                      const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    // TypeRelaxed operations have the same type info as original ones, but precisions are lost on IR reading
+    if (dynamic_cast<const ngraph::op::TypeRelaxedBase*>(op.get()))
+        return false;
+
+    for (const auto& rtInfo : op->get_rt_info()) {
+        if (std::find(serializableRtInfo.begin(), serializableRtInfo.end(), rtInfo.first) == serializableRtInfo.end())
+            return false;
+    }
+
+    if (auto subGraph = std::dynamic_pointer_cast<const ngraph::op::util::SubGraphOp>(op)) {
+        if (!IsSerializableFunction(subGraph->get_function(), customOpsets))
+            return false;
+    }
+
+    static const std::vector<std::reference_wrapper<const ngraph::OpSet>> opsets = {
+        ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(), ngraph::get_opset4(),
+        ngraph::get_opset5(), ngraph::get_opset6(), ngraph::get_opset7(),
+    };
+    for (const auto& opset : opsets) {
+        if (opset.get().contains_op_type(op.get()))
+            return true;
+    }
+    for (const auto& opset : customOpsets) {
+        if (opset.second.contains_op_type(op.get()))
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::IsSerializableFunction(const std::shared_ptr<const ngraph::Function>& function,
+                                          const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    for (const auto& op : function->get_ops()) {
+        if (!isSerializableOp(op, customOpsets))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNPlugin::SerializeNetwork(std::ostream& stream,
+                                    const std::shared_ptr<ngraph::Function>& function,
+                                    bool isTransformed,
+                                    const InputsDataMap& inputs,
+                                    const OutputsDataMap& outputs,
+                                    const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10, customOpsets);
+    serializer.run_on_function(function);
+
+    write(stream, isTransformed);
+    write(stream, xmlFile.str());
+    write(stream, binFile.str());
+
+    // Precisions, layouts and preprocessing are set by a user on CNNNetwork and are not a part of IR
+    write(stream, static_cast<std::uint64_t>(inputs.size()));
+    for (const auto& input : inputs) {
+        write(stream, input.first);
+        write(stream, std::string(input.second->getPrecision().name()));
+        write(stream, static_cast<std::int32_t>(input.second->getLayout()));
+        writePreProcess(stream, input.second->getPreProcess());
+    }
+    write(stream, static_cast<std::uint64_t>(outputs.size()));
+    for (const auto& output : outputs) {
+        write(stream, output.first);
+        write(stream, std::string(output.second->getPrecision().name()));
+        write(stream, static_cast<std::int32_t>(output.second->getLayout()));
+    }
+
+    if (!stream.good())
+        IE_THROW() << "Failed to export CPU network";
+}
+
+CNNNetwork MKLDNNPlugin::DeserializeNetwork(std::istream& stream, const ICore& core, bool& isTransformed) {
+    isTransformed = read<bool>(stream);
+
+    const auto xmlString = readString(stream);
+    const auto binSize = static_cast<size_t>(read<std::uint64_t>(stream));
+    Blob::Ptr dataBlob;
+    if (0 != binSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {binSize}, Layout::C));
+        dataBlob->allocate();
+        stream.read(dataBlob->buffer(), binSize);
+    }
+
+    auto network = core.ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputsInfo = network.getInputsInfo();
+    const auto inputsCount = read<std::uint64_t>(stream);
+    for (std::uint64_t i = 0; i < inputsCount; i++) {
+        const auto name = readString(stream);
+        auto input = inputsInfo.find(name);
+        if (input == inputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Exported CPU network doesn't have input " << name;
+        input->second->setPrecision(Precision::FromStr(readString(stream)));
+        input->second->setLayout(static_cast<Layout>(read<std::int32_t>(stream)));
+        readPreProcess(stream, input->second->getPreProcess());
+    }
+
+    auto outputsInfo = network.getOutputsInfo();
+    const auto outputsCount = read<std::uint64_t>(stream);
+    for (std::uint64_t i = 0; i < outputsCount; i++) {
+        const auto name = readString(stream);
+        auto output = outputsInfo.find(name);
+        if (output == outputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Exported CPU network doesn't have output " << name;
+        output->second->setPrecision(Precision::FromStr(readString(stream)));
+        output->second->setLayout(static_cast<Layout>(read<std::int32_t>(stream)));
+    }
+
+    return network;
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_icore.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset.hpp>
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Checks whether the function can be written to IR v10 and read back without losing information
+ *        which is used by the remaining CPU specific conversion steps (TypeRelaxed operations, runtime info, etc.)
+ */
+bool IsSerializableFunction(const std::shared_ptr<const ngraph::Function>& function,
+                            const std::map<std::string, ngraph::OpSet>& customOpsets);
+
+/**
+ * @brief Writes the function kept by the executable network together with user defined inputs and outputs information
+ * @param stream An output stream
+ * @param function A function to write. Either original one or the one after common nGraph transformations
+ * @param isTransformed Whether common nGraph transformations were already applied to the function
+ */
+void SerializeNetwork(std::ostream& stream,
+                      const std::shared_ptr<ngraph::Function>& function,
+                      bool isTransformed,
+                      const InferenceEngine::InputsDataMap& inputs,
+                      const InferenceEngine::OutputsDataMap& outputs,
+                      const std::map<std::string, ngraph::OpSet>& customOpsets);
+
+/**
+ * @brief Restores the network written by SerializeNetwork
+ * @param stream An input stream
+ * @param core A core used to read IR
+ * @param isTransformed Set to true if common nGraph transformations were already applied to the network
+ */
+InferenceEngine::CNNNetwork DeserializeNetwork(std::istream& stream,
+                                               const InferenceEngine::ICore& core,
+                                               bool& isTransformed);
+
+}  // namespace MKLDNNPlugin
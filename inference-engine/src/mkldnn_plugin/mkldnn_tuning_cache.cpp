@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuning_cache.h"
+#include "mkldnn_edge.h"
+
+#include <ie_common.h>
+#include <ie_system_conf.h>
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+std::string GetCpuIsa() {
+    if (with_cpu_x86_bfloat16())
+        return "avx512_core_bf16";
+    if (with_cpu_x86_avx512_core())
+        return "avx512_core";
+    if (with_cpu_x86_avx512f())
+        return "avx512";
+    if (with_cpu_x86_avx2())
+        return "avx2";
+    if (with_cpu_x86_avx())
+        return "avx";
+    if (with_cpu_x86_sse42())
+        return "sse42";
+    return "any";
+}
+
+// Each line is "<isa> <primitive descriptor index> <node signature>"
+std::map<std::pair<std::string, std::string>, int> ReadDecisions(const std::string& file) {
+    std::map<std::pair<std::string, std::string>, int> decisions;
+    if (file.empty())
+        return decisions;
+    std::ifstream stream(file);
+    std::string line;
+    while (std::getline(stream, line)) {
+        std::istringstream lineStream(line);
+        std::string isa, signature;
+        int index = -1;
+        if (lineStream >> isa >> index >> signature && index >= 0)
+            decisions[{isa, signature}] = index;
+    }
+    return decisions;
+}
+
+template <typename Container>
+void WriteJoined(std::ostream& stream, const Container& values, const char* glue) {
+    const char* separator = "";
+    for (auto value : values) {
+        stream << separator << value;
+        separator = glue;
+    }
+}
+
+void WriteDataConfig(std::ostream& stream, const DataConfig& dataConfig) {
+    const auto& blockingDesc = dataConfig.desc.getBlockingDesc();
+    stream << "/" << dataConfig.desc.getPrecision().name() << ":";
+    WriteJoined(stream, blockingDesc.getOrder(), ".");
+    stream << ":";
+    WriteJoined(stream, blockingDesc.getBlockDims(), ".");
+}
+
+}  // namespace
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string& file) : _file(file), _isa(GetCpuIsa()) {
+    for (auto& decision : ReadDecisions(_file)) {
+        if (decision.first.first == _isa)
+            _decisions[decision.first.second] = decision.second;
+    }
+}
+
+void MKLDNNTuningCache::SelectPrimitiveDescriptor(MKLDNNNode& node) {
+    if (!IsTunable(node)) {
+        node.selectOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto signature = GetSignature(node);
+    const int candidatesCount = static_cast<int>(node.getSupportedPrimitiveDescriptors().size());
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _decisions.find(signature);
+    const bool isStored = found != _decisions.end() && found->second < candidatesCount;
+    if (isStored)
+        node.selectPrimitiveDescriptorByIndex(found->second);
+    else
+        node.selectOptimalPrimitiveDescriptor();
+
+    int selected = -1;
+    for (int i = 0; i < candidatesCount; i++) {
+        if (&node.getSupportedPrimitiveDescriptors()[i] == node.getSelectedPrimitiveDescriptor())
+            selected = i;
+    }
+    _tunableNodes[signature] = {candidatesCount, selected, isStored};
+}
+
+std::map<std::string, MKLDNNTuningCache::TunableNode> MKLDNNTuningCache::GetTunableNodes() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _tunableNodes;
+}
+
+void MKLDNNTuningCache::Store(const std::string& signature, int index) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _decisions[signature] = index;
+}
+
+void MKLDNNTuningCache::Save() const {
+    if (_file.empty())
+        return;
+
+    // the file may be shared by networks loaded concurrently
+    static std::mutex fileMutex;
+    std::lock_guard<std::mutex> fileLock{fileMutex};
+
+    auto decisions = ReadDecisions(_file);
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        for (auto& decision : _decisions)
+            decisions[{_isa, decision.first}] = decision.second;
+    }
+
+    std::ofstream stream(_file, std::ios::out | std::ios::trunc);
+    if (!stream)
+        IE_THROW() << "Can't open tuning file: \"" << _file << "\"";
+    for (auto& decision : decisions)
+        stream << decision.first.first << " " << decision.second << " " << decision.first.second << "\n";
+}
+
+bool MKLDNNTuningCache::IsTunable(MKLDNNNode& node) {
+    // the nodes choosing descriptors to fit their neighbours aren't tuned
+    switch (node.getType()) {
+    case Input:
+    case Output:
+    case Reorder:
+    case Concatenation:
+    case Split:
+    case Eltwise:
+    case MemoryInput:
+    case MemoryOutput:
+    case TensorIterator:
+        return false;
+    default:
+        return node.getSupportedPrimitiveDescriptors().size() > 1;
+    }
+}
+
+std::string MKLDNNTuningCache::GetSignature(MKLDNNNode& node) {
+    std::ostringstream signature;
+    signature << node.getTypeStr();
+    for (auto& fused : node.getFusedWith())
+        signature << "+" << fused->getTypeStr();
+
+    signature << "(";
+    for (size_t i = 0; i < node.getParentEdges().size(); i++) {
+        signature << (i == 0 ? "" : ",");
+        WriteJoined(signature, node.getParentEdgeAt(i)->getDims().ToSizeVector(), "x");
+    }
+    signature << ")";
+
+    for (auto& primitiveDescriptor : node.getSupportedPrimitiveDescriptors()) {
+        const auto config = primitiveDescriptor.getConfig();
+        signature << "|" << static_cast<uint64_t>(primitiveDescriptor.getImplementationType());
+        for (auto& inConf : config.inConfs)
+            WriteDataConfig(signature, inConf);
+        signature << "-";
+        for (auto& outConf : config.outConfs)
+            WriteDataConfig(signature, outConf);
+    }
+    return signature.str();
+}
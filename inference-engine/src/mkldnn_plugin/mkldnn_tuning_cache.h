@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Primitive descriptors chosen for nodes by measuring their execution time in the graph. Decisions are keyed by
+ * the node signature (type, shapes, fused operations and supported primitive descriptors) and the CPU ISA, and persisted in
+ * a text file, so later loads of a network select the measured descriptors without tuning.
+ */
+class MKLDNNTuningCache {
+public:
+    typedef std::shared_ptr<MKLDNNTuningCache> Ptr;
+
+    struct TunableNode {
+        int candidatesCount;
+        // primitive descriptor selected by the graph, either the stored or the optimal one
+        int selected;
+        bool isStored;
+    };
+
+    /**
+     * Loads the decisions made on the current CPU ISA from the file if it exists. The decisions aren't persisted if
+     * the file name is empty
+     */
+    explicit MKLDNNTuningCache(const std::string& file);
+
+    /**
+     * Selects the stored primitive descriptor of the node if there is one, the optimal one otherwise. Tunable
+     * nodes are remembered, so they are returned by GetTunableNodes()
+     */
+    void SelectPrimitiveDescriptor(MKLDNNNode& node);
+
+    std::map<std::string, TunableNode> GetTunableNodes() const;
+
+    void Store(const std::string& signature, int index);
+
+    /**
+     * Writes the decisions to the file. The decisions made in the meantime by other networks and the ones made on
+     * other CPUs are kept
+     */
+    void Save() const;
+
+    static bool IsTunable(MKLDNNNode& node);
+    static std::string GetSignature(MKLDNNNode& node);
+
+private:
+    std::string                         _file;
+    std::string                         _isa;
+    mutable std::mutex                  _mutex;
+    std::map<std::string, int>          _decisions;
+    std::map<std::string, TunableNode>  _tunableNodes;
+};
+
+}  // namespace MKLDNNPlugin
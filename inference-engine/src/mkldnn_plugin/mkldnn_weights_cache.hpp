@@ -68,6 +68,8 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    explicit MKLDNNWeightsSharing(int numaNodeId = -1) : numaNodeId(numaNodeId) {}
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -94,7 +96,13 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * NUMA node the cached memory is placed on, -1 if the placement isn't managed
+     */
+    int GetNumaNodeId() const { return numaNodeId; }
+
 protected:
+    const int numaNodeId;
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
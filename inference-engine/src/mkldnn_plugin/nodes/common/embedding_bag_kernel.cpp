@@ -0,0 +1,267 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cassert>
+#include <limits>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_embedding_bag, field)
+
+namespace {
+
+struct jit_args_embedding_bag {
+    const void* table;
+    const void* indices;
+    const float* weights;
+    float* dst;
+    size_t count;
+};
+
+struct jit_embedding_bag_config_params {
+    Precision table_prc;
+    size_t emb_depth;
+    size_t index_size;
+};
+
+}  // namespace
+
+struct jit_uni_embedding_bag_kernel {
+    void (*ker_)(const jit_args_embedding_bag *);
+
+    void operator()(const jit_args_embedding_bag *args) { assert(ker_); ker_(args); }
+
+    jit_uni_embedding_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_embedding_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_impl : public jit_uni_embedding_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_impl)
+
+    explicit jit_uni_embedding_bag_kernel_impl(jit_embedding_bag_config_params jcp)
+        : jit_uni_embedding_bag_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_count, ptr[reg_params + GET_OFF(count)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        // the row is processed by chunks of unroll vectors, each chunk is accumulated over the whole bag
+        const size_t chunk = unroll * step;
+        const size_t full_chunks = jcp_.emb_depth / chunk;
+        const size_t tail = jcp_.emb_depth % chunk;
+
+        if (full_chunks > 0) {
+            Xbyak::Label chunk_loop_label;
+
+            mov(reg_chunks, full_chunks);
+            L(chunk_loop_label);
+            {
+                accumulate_chunk(unroll, step);
+
+                add(reg_table, chunk * jcp_.table_prc.size());
+                add(reg_dst, chunk * sizeof(float));
+                sub(reg_chunks, 1);
+                jnz(chunk_loop_label, T_NEAR);
+            }
+        }
+        if (tail > 0) {
+            const int vecs = static_cast<int>((tail + step - 1) / step);
+            accumulate_chunk(vecs, static_cast<int>(tail - (vecs - 1) * step));
+        }
+
+        this->postamble();
+
+        load_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int unroll = 4;
+    // number of rows the prefetch runs ahead of the accumulation
+    static constexpr int prefetch_distance = 4;
+    static constexpr int cache_line_size = 64;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_count = r12;
+    Xbyak::Reg64 reg_idx_ptr = r13;
+    Xbyak::Reg64 reg_weights_ptr = r14;
+    Xbyak::Reg64 reg_row = rax;
+    Xbyak::Reg64 reg_prefetch = rdx;
+    Xbyak::Reg64 reg_left = rbx;
+    Xbyak::Reg64 reg_chunks = rbp;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rcx;
+
+    Vmm vmm_val = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+    Vmm vmm_zero = Vmm(unroll + 2);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    jit_embedding_bag_config_params jcp_;
+
+    Vmm vmm_acc(int i) const { return Vmm(i); }
+
+    // reg = table + indices[i] * row_size
+    void row_address(const Xbyak::Reg64& reg, int i) {
+        if (jcp_.index_size == sizeof(int32_t))
+            movsxd(reg, dword[reg_idx_ptr + i * jcp_.index_size]);
+        else
+            mov(reg, qword[reg_idx_ptr + i * jcp_.index_size]);
+        imul(reg, reg, static_cast<int>(jcp_.emb_depth * jcp_.table_prc.size()));
+        add(reg, reg_table);
+    }
+
+    void accumulate_chunk(int vecs, int last_num) {
+        for (int v = 0; v < vecs; v++)
+            uni_vpxor(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+
+        Xbyak::Label unweighted_label;
+        Xbyak::Label end_label;
+
+        cmp(reg_weights, 0);
+        je(unweighted_label, T_NEAR);
+        accumulate_rows(vecs, last_num, true);
+        jmp(end_label, T_NEAR);
+        L(unweighted_label);
+        accumulate_rows(vecs, last_num, false);
+        L(end_label);
+
+        for (int v = 0; v < vecs; v++) {
+            const int num = v == vecs - 1 ? last_num : step;
+            store_emitter->emit_code({static_cast<size_t>(vmm_acc(v).getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                std::make_shared<store_emitter_context>(Precision::FP32, Precision::FP32, num, v * vlen),
+                {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+        }
+    }
+
+    void accumulate_rows(int vecs, int last_num, bool with_weights) {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        const int chunk_bytes = ((vecs - 1) * step + last_num) * static_cast<int>(jcp_.table_prc.size());
+
+        mov(reg_idx_ptr, reg_indices);
+        mov(reg_weights_ptr, reg_weights);
+        mov(reg_left, reg_count);
+
+        L(loop_label);
+        {
+            cmp(reg_left, 0);
+            jle(loop_end_label, T_NEAR);
+
+            row_address(reg_row, 0);
+
+            Xbyak::Label no_prefetch_label;
+            cmp(reg_left, prefetch_distance);
+            jle(no_prefetch_label, T_NEAR);
+            row_address(reg_prefetch, prefetch_distance);
+            for (int offset = 0; offset < chunk_bytes; offset += cache_line_size)
+                prefetcht0(ptr[reg_prefetch + offset]);
+            L(no_prefetch_label);
+
+            if (with_weights)
+                uni_vbroadcastss(vmm_weight, ptr[reg_weights_ptr]);
+
+            for (int v = 0; v < vecs; v++) {
+                const int num = v == vecs - 1 ? last_num : step;
+                load_emitter->emit_code({static_cast<size_t>(reg_row.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+                    std::make_shared<load_emitter_context>(jcp_.table_prc, Precision::FP32, num, false, "zero",
+                                                           v * step * static_cast<int>(jcp_.table_prc.size())),
+                    {}, {load_pool_gpr_idxs});
+                if (with_weights)
+                    uni_vfmadd231ps(vmm_acc(v), vmm_val, vmm_weight);
+                else
+                    uni_vaddps(vmm_acc(v), vmm_acc(v), vmm_val);
+            }
+
+            add(reg_idx_ptr, jcp_.index_size);
+            if (with_weights)
+                add(reg_weights_ptr, sizeof(float));
+            sub(reg_left, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+};
+
+EmbeddingBagKernel::EmbeddingBagKernel(Precision tablePrecision, size_t embDepth, size_t indexSize) {
+    auto jcp = jit_embedding_bag_config_params();
+    jcp.table_prc = tablePrecision;
+    jcp.emb_depth = embDepth;
+    jcp.index_size = indexSize;
+
+    if (tablePrecision != Precision::FP32 && tablePrecision != Precision::BF16)
+        return;
+    if (indexSize != sizeof(int32_t) && indexSize != sizeof(int64_t))
+        return;
+    if (embDepth == 0 || embDepth * tablePrecision.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return;
+
+    if (mayiuse(x64::avx512_common)) {
+        kernel.reset(new jit_uni_embedding_bag_kernel_impl<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_embedding_bag_kernel_impl<x64::avx2>(jcp));
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+void EmbeddingBagKernel::operator()(const uint8_t* table, const void* indices, const float* weights, float* dst, size_t count) const {
+    auto arg = jit_args_embedding_bag();
+    arg.table = table;
+    arg.indices = indices;
+    arg.weights = weights;
+    arg.dst = dst;
+    arg.count = count;
+    (*kernel)(&arg);
+}
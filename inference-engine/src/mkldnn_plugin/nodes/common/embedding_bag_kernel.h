@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct jit_uni_embedding_bag_kernel;
+
+/**
+ * Reduces a bag of embedding table rows into a single FP32 row: dst = sum(table[indices[i]] * weights[i]).
+ * Weights are optional, an empty bag produces zeros. Rows are loaded from FP32 or BF16 tables with conversion
+ * to FP32 on the fly and the upcoming rows of the bag are prefetched while the current one is accumulated.
+ * Indices aren't validated by the kernel.
+ */
+class EmbeddingBagKernel {
+public:
+    /**
+     * @param tablePrecision precision of the embedding table, FP32 or BF16
+     * @param embDepth number of elements in the table row
+     * @param indexSize size of the index in bytes, 4 (signed) or 8
+     */
+    EmbeddingBagKernel(InferenceEngine::Precision tablePrecision, size_t embDepth, size_t indexSize);
+
+    /**
+     * @return true if the kernel is generated for the current machine and the given parameters
+     */
+    bool isSupported() const {
+        return kernel != nullptr;
+    }
+
+    void operator()(const uint8_t* table, const void* indices, const float* weights, float* dst, size_t count) const;
+
+private:
+    std::shared_ptr<jit_uni_embedding_bag_kernel> kernel;
+};
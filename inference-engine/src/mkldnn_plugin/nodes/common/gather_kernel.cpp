@@ -0,0 +1,381 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_kernel.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include <cassert>
+#include <limits>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_gather, field)
+
+namespace {
+
+// rows longer than this are copied by cpu_memcpy in the nodes
+constexpr size_t maxKernelRowSize = 256;
+
+struct jit_args_gather {
+    const void* src;
+    const int32_t* idx;
+    void* dst;
+    size_t work_amount;
+    int32_t index_range;
+};
+
+struct jit_gather_config_params {
+    size_t data_size;
+    size_t row_size;
+    size_t idx_stride;
+    bool linear;
+    // rows of a single element are gathered by vpgatherdd
+    bool vectorized;
+};
+
+}  // namespace
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_args_gather *);
+
+    void operator()(const jit_args_gather *args) { assert(ker_); ker_(args); }
+
+    jit_uni_gather_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_impl : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_impl)
+
+    explicit jit_uni_gather_kernel_impl(jit_gather_config_params jcp) : jit_uni_gather_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_idx, ptr[reg_params + GET_OFF(idx)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        movsxd(reg_range, dword[reg_params + GET_OFF(index_range)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        if (jcp_.vectorized) {
+            gather_elements();
+        } else {
+            gather_rows();
+        }
+
+        this->postamble();
+
+        load_emitter->emit_data();
+
+        if (jcp_.vectorized && jcp_.linear) {
+            align(64);
+            L(l_lanes);
+            for (int i = 0; i < step; i++)
+                dd(static_cast<uint32_t>(i * jcp_.data_size));
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(int32_t);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_idx = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_range = r12;
+    Xbyak::Reg64 reg_row = r13;
+    Xbyak::Reg64 reg_aligned_src = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rcx;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_idx = Vmm(1);
+    Vmm vmm_off = Vmm(2);
+    Vmm vmm_mask = Vmm(3);
+    Vmm vmm_range = Vmm(4);
+    Vmm vmm_minus_one = Vmm(5);
+    Vmm vmm_stride = Vmm(6);
+    Vmm vmm_lanes = Vmm(7);
+    Vmm vmm_shift = Vmm(8);
+    Vmm vmm_tmp = Vmm(9);
+    Vmm vmm_three = Vmm(10);
+    Vmm vmm_elem_mask = Vmm(11);
+    Vmm vmm_zero = Vmm(12);
+
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(13);
+
+    // k1 is used by the load and store emitters
+    Xbyak::Opmask k_gather = Xbyak::Opmask(2);
+
+    Xbyak::Label l_lanes;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    jit_gather_config_params jcp_;
+
+    void broadcast_dword(const Vmm& vmm, uint32_t value) {
+        mov(reg_row.cvt32(), value);
+        movd(xmm_aux, reg_row.cvt32());
+        vpbroadcastd(vmm, xmm_aux);
+    }
+
+    void and_dword(const Vmm& dst, const Vmm& src0, const Vmm& src1) {
+        if (isa == x64::avx512_common)
+            vpandd(dst, src0, src1);
+        else
+            vpand(dst, src0, src1);
+    }
+
+    Precision data_precision() const {
+        switch (jcp_.data_size) {
+            case 1: return Precision::U8;
+            case 2: return Precision::U16;
+            default: return Precision::I32;
+        }
+    }
+
+    void gather_elements() {
+        broadcast_dword(vmm_minus_one, static_cast<uint32_t>(-1));
+        movd(xmm_aux, reg_range.cvt32());
+        vpbroadcastd(vmm_range, xmm_aux);
+        // dword offsets for 4 byte data, byte offsets from the dword aligned source otherwise
+        const size_t stride = jcp_.data_size == sizeof(int32_t) ? jcp_.idx_stride / sizeof(int32_t) : jcp_.idx_stride;
+        broadcast_dword(vmm_stride, static_cast<uint32_t>(stride));
+        if (jcp_.linear) {
+            mov(reg_row, l_lanes);
+            uni_vmovdqu(vmm_lanes, ptr[reg_row]);
+            if (jcp_.data_size == sizeof(int32_t))
+                vpsrld(vmm_lanes, vmm_lanes, 2);
+        }
+        if (jcp_.data_size != sizeof(int32_t)) {
+            broadcast_dword(vmm_three, 3);
+            broadcast_dword(vmm_elem_mask, jcp_.data_size == 1 ? 0xFF : 0xFFFF);
+        }
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            gather_vector(step);
+
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(tail_loop_end_label, T_NEAR);
+
+            gather_vector(1);
+
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+    }
+
+    void gather_vector(int num) {
+        // lanes out of the loaded indices get a negative index and are masked out as well
+        load_emitter->emit_code({static_cast<size_t>(reg_idx.getIdx())}, {static_cast<size_t>(vmm_idx.getIdx())},
+            std::make_shared<load_emitter_context>(Precision::I32, Precision::I32, num, true, "int32_min"),
+            {}, {load_pool_gpr_idxs});
+
+        if (isa == x64::avx512_common) {
+            vpcmpgtd(k_gather, vmm_idx, vmm_minus_one);
+            vpcmpgtd(k_gather | k_gather, vmm_range, vmm_idx);
+        } else {
+            vpcmpgtd(vmm_mask, vmm_idx, vmm_minus_one);
+            vpcmpgtd(vmm_tmp, vmm_range, vmm_idx);
+            and_dword(vmm_mask, vmm_mask, vmm_tmp);
+        }
+
+        vpmulld(vmm_off, vmm_idx, vmm_stride);
+        if (jcp_.linear)
+            vpaddd(vmm_off, vmm_off, vmm_lanes);
+
+        Xbyak::Reg64 reg_base = reg_src;
+        if (jcp_.data_size != sizeof(int32_t)) {
+            // the dword containing the element never crosses a page boundary, so it's safe to read it as a whole
+            mov(reg_aligned_src, reg_src);
+            and_(reg_aligned_src, 3);
+            movd(xmm_aux, reg_aligned_src.cvt32());
+            vpbroadcastd(vmm_shift, xmm_aux);
+            vpaddd(vmm_off, vmm_off, vmm_shift);
+            mov(reg_aligned_src, reg_src);
+            and_(reg_aligned_src, ~static_cast<int>(3));
+            reg_base = reg_aligned_src;
+
+            and_dword(vmm_shift, vmm_off, vmm_three);
+            vpslld(vmm_shift, vmm_shift, 3);
+            vpsrld(vmm_off, vmm_off, 2);
+        }
+
+        uni_vpxor(vmm_val, vmm_val, vmm_val);
+        if (isa == x64::avx512_common)
+            vpgatherdd(vmm_val | k_gather, ptr[reg_base + vmm_off * sizeof(int32_t)]);
+        else
+            vpgatherdd(vmm_val, ptr[reg_base + vmm_off * sizeof(int32_t)], vmm_mask);
+
+        if (jcp_.data_size != sizeof(int32_t)) {
+            vpsrlvd(vmm_val, vmm_val, vmm_shift);
+            and_dword(vmm_val, vmm_val, vmm_elem_mask);
+        }
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::I32, data_precision(), num),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+
+        add(reg_idx, num * sizeof(int32_t));
+        add(reg_dst, num * jcp_.data_size);
+        if (jcp_.linear)
+            add(reg_src, num * jcp_.data_size);
+    }
+
+    void gather_rows() {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            Xbyak::Label zero_row_label;
+            Xbyak::Label next_row_label;
+
+            movsxd(reg_row, dword[reg_idx]);
+            cmp(reg_row, 0);
+            jl(zero_row_label, T_NEAR);
+            cmp(reg_row, reg_range);
+            jge(zero_row_label, T_NEAR);
+
+            imul(reg_row, reg_row, static_cast<int>(jcp_.idx_stride));
+            add(reg_row, reg_src);
+            copy_row(true);
+            jmp(next_row_label, T_NEAR);
+
+            L(zero_row_label);
+            copy_row(false);
+
+            L(next_row_label);
+            add(reg_idx, sizeof(int32_t));
+            add(reg_dst, jcp_.row_size);
+            if (jcp_.linear)
+                add(reg_src, jcp_.data_size);
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    // copies the row from reg_row to reg_dst or fills the destination row with zeros
+    void copy_row(bool copy) {
+        const size_t row_size = jcp_.row_size;
+        size_t offset = 0;
+        for (; offset + vlen <= row_size; offset += vlen) {
+            if (copy) {
+                uni_vmovdqu(vmm_val, ptr[reg_row + offset]);
+                uni_vmovdqu(ptr[reg_dst + offset], vmm_val);
+            } else {
+                uni_vmovdqu(ptr[reg_dst + offset], vmm_zero);
+            }
+        }
+        const int tail = static_cast<int>(row_size - offset);
+        if (tail == 0)
+            return;
+        if (copy) {
+            load_emitter->emit_code({static_cast<size_t>(reg_row.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+                std::make_shared<load_emitter_context>(Precision::U8, Precision::U8, tail, false, "zero", static_cast<int>(offset)),
+                {}, {load_pool_gpr_idxs});
+        }
+        store_emitter->emit_code({static_cast<size_t>(copy ? vmm_val.getIdx() : vmm_zero.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::U8, Precision::U8, tail, static_cast<int>(offset)),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+};
+
+GatherKernel::GatherKernel(size_t dataSize, size_t rowSize, size_t idxStride, bool linearOffsets, size_t srcSize) {
+    auto jcp = jit_gather_config_params();
+    jcp.data_size = dataSize;
+    jcp.row_size = rowSize;
+    jcp.idx_stride = idxStride;
+    jcp.linear = linearOffsets;
+    // offsets of the gathered elements, including the source misalignment, are computed in 32 bits
+    jcp.vectorized = rowSize == dataSize && (dataSize == 1 || dataSize == 2 || dataSize == 4) &&
+                     srcSize + sizeof(int32_t) < static_cast<size_t>(std::numeric_limits<int32_t>::max());
+
+    if (rowSize == 0 || idxStride > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return;
+    if (!jcp.vectorized && rowSize > maxKernelRowSize)
+        return;
+
+    if (mayiuse(x64::avx512_common)) {
+        kernel.reset(new jit_uni_gather_kernel_impl<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_gather_kernel_impl<x64::avx2>(jcp));
+    } else if (mayiuse(x64::sse41)) {
+        // there is no vector gather instruction before AVX2
+        if (jcp.vectorized && rowSize > maxKernelRowSize)
+            return;
+        jcp.vectorized = false;
+        kernel.reset(new jit_uni_gather_kernel_impl<x64::sse41>(jcp));
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+void GatherKernel::operator()(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count, int32_t indexRange) const {
+    auto arg = jit_args_gather();
+    arg.src = src;
+    arg.idx = indices;
+    arg.dst = dst;
+    arg.work_amount = count;
+    arg.index_range = indexRange;
+    (*kernel)(&arg);
+}
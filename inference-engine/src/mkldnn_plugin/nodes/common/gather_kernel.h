@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct jit_uni_gather_kernel;
+
+/**
+ * Gathers rows of the source data by indices: the destination row i is a copy of rowSize bytes located at
+ * src + indices[i] * idxStride, or zeros if indices[i] is out of [0, indexRange).
+ * If linearOffsets is set, the source of row i is additionally shifted by i * dataSize bytes, it's used to gather
+ * elements along an outer axis.
+ *
+ * Rows of a single element of 1, 2 or 4 bytes are gathered by vpgatherdd on AVX2 and AVX-512 without any conversion
+ * of the data, short rows are copied by the kernel row by row. Long rows are not handled by the kernel,
+ * since the row copy cost dominates over the per index overhead.
+ */
+class GatherKernel {
+public:
+    /**
+     * @param dataSize size of the data element in bytes
+     * @param rowSize size of the gathered row in bytes
+     * @param idxStride distance in bytes between source rows addressed by consecutive indices
+     * @param linearOffsets if set, source of row i is shifted by i * dataSize bytes
+     * @param srcSize size of the source data in bytes addressed by a single call
+     */
+    GatherKernel(size_t dataSize, size_t rowSize, size_t idxStride, bool linearOffsets, size_t srcSize);
+
+    /**
+     * @return true if the kernel is generated for the current machine and the given parameters
+     */
+    bool isSupported() const {
+        return kernel != nullptr;
+    }
+
+    void operator()(const uint8_t* src, const int32_t* indices, uint8_t* dst, size_t count, int32_t indexRange) const;
+
+private:
+    std::shared_ptr<jit_uni_gather_kernel> kernel;
+};
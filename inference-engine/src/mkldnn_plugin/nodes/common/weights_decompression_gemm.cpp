@@ -0,0 +1,375 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression_gemm.h"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
+#include "ie_parallel.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_weights_decompression, field)
+
+namespace {
+
+// number of source rows the block of weights is applied to at once
+constexpr size_t maxRows = 4;
+constexpr size_t maxBlockSize = 32;
+constexpr size_t paramsAlignment = 64;
+// signed 4 bits values are stored with this offset to make all nibbles unsigned
+constexpr int int4Offset = 8;
+
+struct jit_args_weights_decompression {
+    const float* src;
+    const uint8_t* weights;
+    const float* scale;
+    const float* shift;
+    const float* bias;
+    float* dst;
+    size_t src_stride;
+    size_t dst_stride;
+    size_t rows;
+};
+
+struct jit_weights_decompression_config_params {
+    size_t K;
+    bool int4;
+    bool is_signed;
+};
+
+size_t blockSizeFor(cpu_isa_t isa) {
+    // two vectors of outputs
+    return 2 * (isa == x64::avx512_common ? cpu_isa_traits<x64::avx512_common>::vlen : cpu_isa_traits<x64::avx2>::vlen) / sizeof(float);
+}
+
+}  // namespace
+
+struct jit_uni_weights_decompression_kernel {
+    void (*ker_)(const jit_args_weights_decompression *);
+
+    void operator()(const jit_args_weights_decompression *args) { assert(ker_); ker_(args); }
+
+    jit_uni_weights_decompression_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_weights_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_weights_decompression_kernel_impl : public jit_uni_weights_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_weights_decompression_kernel_impl)
+
+    explicit jit_uni_weights_decompression_kernel_impl(jit_weights_decompression_config_params jcp)
+        : jit_uni_weights_decompression_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_shift, ptr[reg_params + GET_OFF(shift)]);
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(scale)]);
+        for (int j = 0; j < vecs; j++)
+            uni_vmovups(vmm_scale(j), ptr[reg_tmp + j * vlen]);
+        if (jcp_.int4) {
+            mov(reg_tmp, l_table);
+            uni_vbroadcastss(vmm_mask, ptr[reg_tmp]);
+        }
+
+        // the code is unrolled by rows, the number of rows is dispatched at runtime
+        Xbyak::Label end_label;
+        for (int rows = static_cast<int>(maxRows); rows > 0; rows--) {
+            Xbyak::Label next_label;
+            cmp(reg_rows, rows);
+            jne(next_label, T_NEAR);
+            compute(rows);
+            jmp(end_label, T_NEAR);
+            L(next_label);
+        }
+        L(end_label);
+
+        this->postamble();
+
+        if (jcp_.int4)
+            prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int vecs = 2;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_shift = r10;
+    Xbyak::Reg64 reg_bias = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_src_stride = r13;
+    Xbyak::Reg64 reg_dst_stride = r14;
+    Xbyak::Reg64 reg_rows = r15;
+    Xbyak::Reg64 reg_w = rax;
+    Xbyak::Reg64 reg_src_k = rbx;
+    Xbyak::Reg64 reg_src_k2 = rdx;
+    Xbyak::Reg64 reg_k = rbp;
+    Xbyak::Reg64 reg_tmp = rsi;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(maxRows * vecs + 2 * vecs);
+    Vmm vmm_mask = Vmm(maxRows * vecs + 2 * vecs + 1);
+
+    Xbyak::Label l_table;
+
+    jit_weights_decompression_config_params jcp_;
+
+    Vmm vmm_acc(int r, int j) const { return Vmm(r * vecs + j); }
+    Vmm vmm_w(int j) const { return Vmm(maxRows * vecs + j); }
+    Vmm vmm_scale(int j) const { return Vmm(maxRows * vecs + vecs + j); }
+
+    // rows 0 and 1 are addressed from the first pointer, rows 2 and 3 from the second one
+    Xbyak::Address row_ptr(const Xbyak::Reg64& reg_ptr, const Xbyak::Reg64& reg_ptr2, const Xbyak::Reg64& reg_stride,
+                           int r, int offset) {
+        const Xbyak::Reg64& base = r < 2 ? reg_ptr : reg_ptr2;
+        return r % 2 == 0 ? ptr[base + offset] : ptr[base + reg_stride + offset];
+    }
+
+    // dequantizes weights of the current k for the whole block of outputs: w = q * scale + shift
+    void load_weights() {
+        if (jcp_.int4) {
+            // the low nibbles hold the first vector of outputs, the high ones hold the second vector
+            uni_vpmovzxbd(vmm_w(0), ptr[reg_w]);
+            uni_vpsrld(vmm_w(1), vmm_w(0), 4);
+            if (isa == x64::avx512_common)
+                vpandd(vmm_w(0), vmm_w(0), vmm_mask);
+            else
+                uni_vandps(vmm_w(0), vmm_w(0), vmm_mask);
+        } else {
+            for (int j = 0; j < vecs; j++) {
+                if (jcp_.is_signed)
+                    uni_vpmovsxbd(vmm_w(j), ptr[reg_w + j * step]);
+                else
+                    uni_vpmovzxbd(vmm_w(j), ptr[reg_w + j * step]);
+            }
+        }
+        for (int j = 0; j < vecs; j++) {
+            uni_vcvtdq2ps(vmm_w(j), vmm_w(j));
+            uni_vfmadd213ps(vmm_w(j), vmm_scale(j), ptr[reg_shift + j * vlen]);
+        }
+    }
+
+    void compute(int rows) {
+        for (int r = 0; r < rows; r++)
+            for (int j = 0; j < vecs; j++)
+                uni_vpxor(vmm_acc(r, j), vmm_acc(r, j), vmm_acc(r, j));
+
+        mov(reg_w, reg_weights);
+        mov(reg_src_k, reg_src);
+        lea(reg_src_k2, ptr[reg_src + reg_src_stride * 2]);
+        mov(reg_k, jcp_.K);
+
+        const int bytes_per_k = jcp_.int4 ? step : vecs * step;
+
+        Xbyak::Label k_loop_label;
+        L(k_loop_label);
+        {
+            load_weights();
+            for (int r = 0; r < rows; r++) {
+                uni_vbroadcastss(vmm_src, row_ptr(reg_src_k, reg_src_k2, reg_src_stride, r, 0));
+                for (int j = 0; j < vecs; j++)
+                    uni_vfmadd231ps(vmm_acc(r, j), vmm_w(j), vmm_src);
+            }
+
+            add(reg_w, bytes_per_k);
+            add(reg_src_k, sizeof(float));
+            add(reg_src_k2, sizeof(float));
+            sub(reg_k, 1);
+            jnz(k_loop_label, T_NEAR);
+        }
+
+        Xbyak::Label no_bias_label;
+        cmp(reg_bias, 0);
+        je(no_bias_label, T_NEAR);
+        for (int j = 0; j < vecs; j++) {
+            uni_vmovups(vmm_w(j), ptr[reg_bias + j * vlen]);
+            for (int r = 0; r < rows; r++)
+                uni_vaddps(vmm_acc(r, j), vmm_acc(r, j), vmm_w(j));
+        }
+        L(no_bias_label);
+
+        lea(reg_tmp, ptr[reg_dst + reg_dst_stride * 2]);
+        for (int r = 0; r < rows; r++)
+            for (int j = 0; j < vecs; j++)
+                uni_vmovups(row_ptr(reg_dst, reg_tmp, reg_dst_stride, r, j * vlen), vmm_acc(r, j));
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        dd(0x0000000F);
+    }
+};
+
+WeightsDecompressionGemm::WeightsDecompressionGemm(Precision precision, size_t N, size_t K, bool int4)
+        : precision(precision), N(N), K(K), int4(int4) {
+    auto jcp = jit_weights_decompression_config_params();
+    jcp.K = K;
+    jcp.int4 = int4;
+    jcp.is_signed = precision == Precision::I8;
+
+    if (precision != Precision::I8 && precision != Precision::U8)
+        return;
+    if (N == 0 || K == 0)
+        return;
+
+    if (mayiuse(x64::avx512_common)) {
+        kernel.reset(new jit_uni_weights_decompression_kernel_impl<x64::avx512_common>(jcp));
+        blockSize = blockSizeFor(x64::avx512_common);
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_weights_decompression_kernel_impl<x64::avx2>(jcp));
+        blockSize = blockSizeFor(x64::avx2);
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+bool WeightsDecompressionGemm::isSupportedByPlatform() {
+    return mayiuse(x64::avx2);
+}
+
+bool WeightsDecompressionGemm::fitsInt4(const void* weights, Precision precision, size_t count) {
+    if (precision == Precision::I8) {
+        const auto* data = static_cast<const int8_t*>(weights);
+        return std::all_of(data, data + count, [](int8_t q) { return q >= -int4Offset && q < int4Offset; });
+    } else if (precision == Precision::U8) {
+        const auto* data = static_cast<const uint8_t*>(weights);
+        return std::all_of(data, data + count, [](uint8_t q) { return q < 2 * int4Offset; });
+    }
+    return false;
+}
+
+size_t WeightsDecompressionGemm::weightsSize() const {
+    const size_t blocks = div_up(N, blockSize);
+    return blocks * K * (int4 ? blockSize / 2 : blockSize);
+}
+
+size_t WeightsDecompressionGemm::packedSize() const {
+    // weights are followed by the scales and the shifts padded to the whole number of blocks
+    return rnd_up(weightsSize(), paramsAlignment) + 2 * rnd_up(N, blockSize) * sizeof(float);
+}
+
+void WeightsDecompressionGemm::pack(const void* weights, size_t nStride, size_t kStride,
+                                    const std::vector<float>& scale, const std::vector<float>& shift, uint8_t* packed) const {
+    const size_t blocks = div_up(N, blockSize);
+    const size_t paddedN = blocks * blockSize;
+    const bool isSigned = precision == Precision::I8;
+
+    auto* packedScale = reinterpret_cast<float*>(packed + rnd_up(weightsSize(), paramsAlignment));
+    auto* packedShift = packedScale + paddedN;
+    for (size_t n = 0; n < paddedN; n++) {
+        packedScale[n] = n < N ? scale[scale.size() == 1 ? 0 : n] : 0.f;
+        packedShift[n] = n < N ? shift[shift.size() == 1 ? 0 : n] : 0.f;
+        // the offset of the signed 4 bits values is compensated by the shift
+        if (int4 && isSigned)
+            packedShift[n] -= int4Offset * packedScale[n];
+    }
+
+    // padded outputs get zero weights, so their dequantized values are zeros as well
+    auto value = [&](size_t n, size_t k) -> int {
+        if (n >= N)
+            return 0;
+        const size_t idx = n * nStride + k * kStride;
+        if (isSigned) {
+            const int q = static_cast<const int8_t*>(weights)[idx];
+            return int4 ? q + int4Offset : q;
+        }
+        return static_cast<const uint8_t*>(weights)[idx];
+    };
+
+    const size_t halfBlock = blockSize / 2;
+    parallel_for(blocks, [&](size_t b) {
+        const size_t n0 = b * blockSize;
+        uint8_t* dst = packed + b * K * (int4 ? halfBlock : blockSize);
+        for (size_t k = 0; k < K; k++) {
+            if (int4) {
+                for (size_t j = 0; j < halfBlock; j++)
+                    *dst++ = static_cast<uint8_t>(value(n0 + j, k) | (value(n0 + halfBlock + j, k) << 4));
+            } else {
+                for (size_t j = 0; j < blockSize; j++)
+                    *dst++ = static_cast<uint8_t>(value(n0 + j, k));
+            }
+        }
+    });
+}
+
+void WeightsDecompressionGemm::operator()(const float* src, size_t M, const uint8_t* packed, const float* bias, float* dst) const {
+    const size_t nBlocks = div_up(N, blockSize);
+    const size_t mBlocks = div_up(M, maxRows);
+    const size_t blockBytes = K * (int4 ? blockSize / 2 : blockSize);
+    const auto* scale = reinterpret_cast<const float*>(packed + rnd_up(weightsSize(), paramsAlignment));
+    const auto* shift = scale + nBlocks * blockSize;
+
+    auto compute = [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * maxRows;
+        const size_t n0 = nb * blockSize;
+
+        auto arg = jit_args_weights_decompression();
+        arg.src = src + m0 * K;
+        arg.weights = packed + nb * blockBytes;
+        arg.scale = scale + n0;
+        arg.shift = shift + n0;
+        arg.src_stride = K * sizeof(float);
+        arg.rows = std::min(maxRows, M - m0);
+
+        if (n0 + blockSize <= N) {
+            arg.bias = bias ? bias + n0 : nullptr;
+            arg.dst = dst + m0 * N + n0;
+            arg.dst_stride = N * sizeof(float);
+            (*kernel)(&arg);
+        } else {
+            // the last block is computed to a local buffer not to access the data out of bounds
+            float tailBias[maxBlockSize] = {};
+            float tailDst[maxRows * maxBlockSize];
+            if (bias)
+                std::copy(bias + n0, bias + N, tailBias);
+            arg.bias = bias ? tailBias : nullptr;
+            arg.dst = tailDst;
+            arg.dst_stride = blockSize * sizeof(float);
+            (*kernel)(&arg);
+            for (size_t m = 0; m < arg.rows; m++)
+                std::copy(tailDst + m * blockSize, tailDst + m * blockSize + (N - n0), dst + (m0 + m) * N + n0);
+        }
+    };
+
+    // a block of weights is reused by all the rows while it's in cache if there are enough blocks for all threads
+    if (nBlocks >= static_cast<size_t>(parallel_get_max_threads())) {
+        parallel_for(nBlocks, [&](size_t nb) {
+            for (size_t mb = 0; mb < mBlocks; mb++)
+                compute(mb, nb);
+        });
+    } else {
+        parallel_for2d(mBlocks, nBlocks, compute);
+    }
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct jit_uni_weights_decompression_kernel;
+
+/**
+ * Multiplies FP32 rows by weights compressed to 8 or 4 bits:
+ *     dst[m][n] = sum_k src[m][k] * (q[n][k] * scale[n] + shift[n]) + bias[n]
+ * Weights are repacked by blocks of outputs, every block is streamed once per group of rows and dequantized
+ * in registers, so the weights never exist in FP32 and the memory traffic is 4x (8 bits) or 8x (4 bits) lower.
+ * Source and destination are dense row-major matrices.
+ */
+class WeightsDecompressionGemm {
+public:
+    /**
+     * @param precision precision of the weights, I8 or U8
+     * @param N number of outputs (rows of the weights)
+     * @param K number of inputs (columns of the weights)
+     * @param int4 pack the weights by two per byte, all of them must fit in 4 bits (see fitsInt4)
+     */
+    WeightsDecompressionGemm(InferenceEngine::Precision precision, size_t N, size_t K, bool int4);
+
+    /**
+     * @return true if the kernel is generated for the current machine
+     */
+    bool isSupported() const {
+        return kernel != nullptr;
+    }
+
+    static bool isSupportedByPlatform();
+
+    /**
+     * @return true if all the given I8 or U8 values can be stored in 4 bits without loss
+     */
+    static bool fitsInt4(const void* weights, InferenceEngine::Precision precision, size_t count);
+
+    /**
+     * @return size in bytes of the buffer the weights and their dequantization parameters are packed to
+     */
+    size_t packedSize() const;
+
+    /**
+     * Packs the weights along with the dequantization parameters. Element (n, k) of the weights is taken from
+     * weights[n * nStride + k * kStride], scale and shift have either N or 1 element.
+     */
+    void pack(const void* weights, size_t nStride, size_t kStride,
+              const std::vector<float>& scale, const std::vector<float>& shift, uint8_t* packed) const;
+
+    /**
+     * @param src M x K matrix
+     * @param packed buffer filled by pack
+     * @param bias N elements or nullptr
+     * @param dst M x N matrix
+     */
+    void operator()(const float* src, size_t M, const uint8_t* packed, const float* bias, float* dst) const;
+
+private:
+    size_t weightsSize() const;
+
+    InferenceEngine::Precision precision;
+    size_t N;
+    size_t K;
+    bool int4;
+    size_t blockSize = 0;
+
+    std::shared_ptr<jit_uni_weights_decompression_kernel> kernel;
+};
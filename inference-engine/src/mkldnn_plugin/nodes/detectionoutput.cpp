@@ -11,6 +11,7 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "nms_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -101,13 +102,6 @@ public:
             _reordered_conf = InferenceEngine::make_shared_blob<float>({Precision::FP32, conf_size, ANY});
             _reordered_conf->allocate();
 
-            InferenceEngine::SizeVector decoded_bboxes_size{static_cast<size_t>(_num),
-                                                            static_cast<size_t>(_num_priors),
-                                                            static_cast<size_t>(_num_classes)};
-            _bbox_sizes = InferenceEngine::make_shared_blob<float>(
-                    {Precision::FP32, decoded_bboxes_size, {decoded_bboxes_size, {0, 1, 2}}});
-            _bbox_sizes->allocate();
-
             InferenceEngine::SizeVector num_priors_actual_size{static_cast<size_t>(_num)};
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
@@ -133,7 +127,6 @@ public:
 
         float *decoded_bboxes_data = _decoded_bboxes->buffer().as<float *>();
         float *reordered_conf_data = _reordered_conf->buffer().as<float *>();
-        float *bbox_sizes_data     = _bbox_sizes->buffer().as<float *>();
         int *detections_data       = _detections_count->buffer().as<int *>();
         int *buffer_data           = _buffer->buffer().as<int *>();
         int *indices_data          = _indices->buffer().as<int *>();
@@ -150,14 +143,13 @@ public:
             if (_share_location) {
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
-                float *psizes = bbox_sizes_data + n*_num_priors;
 
                 if (with_add_box_pred) {
                     const float *p_arm_loc = arm_loc_data + n*4*_num_priors;
-                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, num_priors_actual, n, 0, 4, false);
                 } else {
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
                 }
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
@@ -166,13 +158,12 @@ public:
                     }
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
-                    float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
                     if (with_add_box_pred) {
                         const float *p_arm_loc = arm_loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                        decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
+                        decodeBBoxes(pboxes, ploc, prior_variances, pboxes, num_priors_actual, n, 0, 4, false);
                     } else {
-                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                        decodeBBoxes(ppriors, ploc, prior_variances, pboxes, num_priors_actual, n, _offset, _prior_size);
                     }
                 }
             }
@@ -217,16 +208,13 @@ public:
 
                         const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
                         const float *pboxes;
-                        const float *psizes;
                         if (_share_location) {
                             pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
                         } else {
                             pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                         }
 
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                        nms_cf(pconf, pboxes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
                     }
                 });
             } else {
@@ -237,9 +225,8 @@ public:
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
                 const float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors;
-                const float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors;
 
-                nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
+                nms_mx(pconf, pboxes, pbuffer, pindices, pdetections, _num_priors);
             }
 
             for (int c = 0; c < _num_classes; ++c) {
@@ -387,13 +374,13 @@ private:
     };
 
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
+                      float *decoded_bboxes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true); // after ARM = false
 
-    void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
+    void nms_cf(const float *conf_data, const float *bboxes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
 
-    void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
+    void nms_mx(const float *conf_data, const float *bboxes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
 
     InferenceEngine::Blob::Ptr _decoded_bboxes;
@@ -401,7 +388,6 @@ private:
     InferenceEngine::Blob::Ptr _indices;
     InferenceEngine::Blob::Ptr _detections_count;
     InferenceEngine::Blob::Ptr _reordered_conf;
-    InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
 };
 
@@ -417,48 +403,10 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
-
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        const float *loc_data,
                                        const float *variance_data,
                                        float *decoded_bboxes,
-                                       float *decoded_bbox_sizes,
                                        int* num_priors_actual,
                                        int n,
                                        const int& offs,
@@ -551,14 +499,11 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         decoded_bboxes[p*4 + 1] = new_ymin;
         decoded_bboxes[p*4 + 2] = new_xmax;
         decoded_bboxes[p*4 + 3] = new_ymax;
-
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
     });
 }
 
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
-                          const float* sizes,
                           int* buffer,
                           int* indices,
                           int& detections,
@@ -577,28 +522,24 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    std::vector<float> candidates(num_output_scores * 4);
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
+        std::copy(bboxes + buffer[i]*4, bboxes + buffer[i]*4 + 4, &candidates[i*4]);
+    }
+
+    nms_conf conf = {_nms_threshold, false, static_cast<size_t>(num_output_scores)};
+    nms_kept_boxes kept;
+    kept.reset(num_output_scores);
+    std::vector<int> selected(num_output_scores);
+    XARCH::nms_select(candidates.data(), num_output_scores, kept, selected.data(), conf);
+
+    for (size_t k = 0; k < kept.size; ++k) {
+        indices[detections++] = buffer[selected[k]];
     }
 }
 
 void DetectionOutputImpl::nms_mx(const float* conf_data,
                           const float* bboxes,
-                          const float* sizes,
                           int* buffer,
                           int* indices,
                           int* detections,
@@ -626,30 +567,35 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    // classes are suppressed independently, the order of the candidates is kept within the class
+    std::vector<std::vector<int>> class_candidates(_num_classes);
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-        const int cls = idx/_num_priors;
-        const int prior = idx%_num_priors;
+        class_candidates[buffer[i]/_num_priors].push_back(buffer[i]%_num_priors);
+    }
+
+    std::vector<float> candidates;
+    std::vector<int> selected;
+    nms_kept_boxes kept;
+    for (int cls = 0; cls < _num_classes; ++cls) {
+        const auto& priors = class_candidates[cls];
+        if (priors.empty())
+            continue;
+
+        const float *pboxes = _share_location ? bboxes : bboxes + cls*_num_priors*4;
+        candidates.resize(priors.size() * 4);
+        for (size_t i = 0; i < priors.size(); ++i) {
+            std::copy(pboxes + priors[i]*4, pboxes + priors[i]*4 + 4, &candidates[i*4]);
+        }
+
+        nms_conf conf = {_nms_threshold, false, priors.size()};
+        kept.reset(priors.size());
+        selected.resize(priors.size());
+        XARCH::nms_select(candidates.data(), priors.size(), kept, selected.data(), conf);
 
         int &ndetection = detections[cls];
         int *pindices = indices + cls*_num_priors;
-
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            pindices[ndetection++] = prior;
+        for (size_t k = 0; k < kept.size; ++k) {
+            pindices[ndetection++] = priors[selected[k]];
         }
     }
 }
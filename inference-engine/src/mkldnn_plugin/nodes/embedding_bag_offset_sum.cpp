@@ -30,12 +30,30 @@ public:
 
         _indicesLen = indicesData->getTensorDesc().getDims()[0];
         _offsetsLen = offsetsData->getTensorDesc().getDims()[0];
+
+        initKernel(layer, indicesData->getTensorDesc().getPrecision().size());
     }
 
     StatusCode execute(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
                 ResponseDesc* resp) noexcept override {
+        if (_kernel) {
+            switch (inputs[1]->getTensorDesc().getPrecision()) {
+                case Precision::I32: {
+                    return processDataByKernel<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
+                }
+                case Precision::I64: {
+                    return processDataByKernel<PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
+                }
+                case Precision::U64: {
+                    return processDataByKernel<PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
+                }
+                default:
+                    break;
+            }
+        }
+
         switch (inputs[0]->getTensorDesc().getPrecision()) {
             case Precision::FP32: {
                 return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
@@ -87,6 +105,76 @@ protected:
         }
     }
 
+    template<typename I>
+    StatusCode processDataByKernel(
+                std::vector<Blob::Ptr>& inputs,
+                std::vector<Blob::Ptr>& outputs,
+                ResponseDesc* resp) noexcept {
+        std::string errorMsg;
+        std::string msgPrefix = std::string("Layer EmbeddingBagOffsetsSum with name '") + _layerName + "' ";
+
+        const auto& tableDesc = inputs[0]->getTensorDesc();
+        const uint8_t* srcData = inputs[0]->cbuffer().as<const uint8_t*>() +
+            tableDesc.getBlockingDesc().getOffsetPadding() * tableDesc.getPrecision().size();
+        float* dstData = outputs[0]->buffer().as<float*>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const I* indicesData = inputs[INDICES_IDX]->cbuffer().as<const I*>();
+        const I* offsetsData = inputs[OFFSETS_IDX]->cbuffer().as<const I*>();
+        const I* defaultIndex = nullptr;
+        if (inputs.size() > DEFAULT_INDEX_IDX) {
+            defaultIndex = inputs[DEFAULT_INDEX_IDX]->cbuffer().as<const I*>();
+            if (static_cast<int64_t>(defaultIndex[0]) < 0 || static_cast<size_t>(defaultIndex[0]) >= _indicesLen) {
+                std::string msg =  "Invalid default index: " + std::to_string(defaultIndex[0]);
+                msg.copy(resp->msg, sizeof(resp->msg) - 1);
+                return GENERAL_ERROR;
+            }
+        }
+        const float* weightsData = nullptr;
+        if (_withWeights)
+            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const float*>();
+
+        const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+        if (outputBagsNum > _offsetsLen) {
+            msgPrefix += "has invalid embedding bag index.";
+            msgPrefix.copy(resp->msg, sizeof(resp->msg) - 1);
+            return GENERAL_ERROR;
+        }
+
+        std::vector<Bag<I>> bags(outputBagsNum);
+        for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+            const size_t offset = static_cast<size_t>(offsetsData[obi]);
+            const size_t next = obi == _offsetsLen - 1lu ? _indicesLen : static_cast<size_t>(offsetsData[obi + 1lu]);
+            if (offset >= _indicesLen || next < offset || next > _indicesLen) {
+                errorMsg = msgPrefix + ". Offset value exceeds indices size in the model.\noffset: "
+                    + std::to_string(offsetsData[obi]) + "; indices size: " + std::to_string(_indicesLen);
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+                return GENERAL_ERROR;
+            }
+
+            auto& bag = bags[obi];
+            if (next != offset) {
+                bag.indices = indicesData + offset;
+                bag.size = next - offset;
+                if (_withWeights)
+                    bag.weights = weightsData + offset;
+            } else if (defaultIndex != nullptr) {
+            // Empty bag filled by the default index without weights
+                bag.indices = defaultIndex;
+                bag.size = 1lu;
+            }
+        }
+
+        processBagsByKernel(srcData, dstData, bags, tableDesc.getDims()[0], errorMsg);
+
+        if (!errorMsg.empty()) {
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            return GENERAL_ERROR;
+        }
+
+        return OK;
+    }
+
     template<typename T, typename I>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
@@ -22,6 +22,8 @@ public:
         _indices = std::vector<std::vector<size_t>>(
             indicesData->getTensorDesc().getDims()[0],
             std::vector<size_t>(indicesData->getTensorDesc().getDims()[1], 0lu));
+
+        initKernel(layer, sizeof(size_t));
     }
 
     void initFromInputs(std::vector<Blob::Ptr>& inputs) override {
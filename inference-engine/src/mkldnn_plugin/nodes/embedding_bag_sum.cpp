@@ -98,6 +98,9 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
+    if (_kernel)
+        return processDataByKernel(inputs, outputs, resp);
+
     switch (inputs[0]->getTensorDesc().getPrecision()) {
         case Precision::FP32: {
             processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
@@ -128,6 +131,72 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
     return OK;
 }
 
+void MKLDNNEmbeddingBagSum::initKernel(const CNNLayer* layer, size_t indexSize) {
+    if (!errorMsg.empty() || confs.empty())
+        return;
+
+    const auto& tableDesc = layer->insData[0].lock()->getTensorDesc();
+    const auto tablePrecision = tableDesc.getPrecision();
+    if (tablePrecision != Precision::FP32 && tablePrecision != Precision::BF16)
+        return;
+
+    _kernel = std::make_shared<EmbeddingBagKernel>(tablePrecision, _embDepth, indexSize);
+    if (!_kernel->isSupported()) {
+        _kernel.reset();
+        return;
+    }
+
+    // The kernel converts BF16 rows on load, so the table isn't reordered to FP32 as a whole
+    if (tablePrecision == Precision::BF16) {
+        confs[0].inConfs[0].desc = TensorDesc(tablePrecision, tableDesc.getDims(),
+            TensorDesc::getLayoutByDims(tableDesc.getDims()));
+    }
+}
+
+StatusCode MKLDNNEmbeddingBagSum::processDataByKernel(
+            std::vector<Blob::Ptr>& inputs,
+            std::vector<Blob::Ptr>& outputs,
+            ResponseDesc *resp) noexcept {
+    const auto& tableDesc = inputs[0]->getTensorDesc();
+    const uint8_t* srcData = inputs[0]->cbuffer().as<const uint8_t*>() +
+        tableDesc.getBlockingDesc().getOffsetPadding() * tableDesc.getPrecision().size();
+    float* dstData = outputs[0]->buffer().as<float*>() +
+        outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const float* weightsData = nullptr;
+    if (_withWeights)
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const float*>();
+
+    std::string errorMsg;
+    try {
+        initFromInputs(inputs);
+
+        const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+        std::vector<Bag<size_t>> bags(outputBagsNum);
+        parallel_for(outputBagsNum, [&](size_t obi) {
+            size_t weightsIdx = 0lu;
+            bool withWeights = _withWeights;
+            auto& bag = bags[obi];
+            getIndices(obi, bag.indices, bag.size, weightsIdx, withWeights);
+            if (bag.indices == nullptr)
+                bag.size = 0lu;
+            else if (withWeights && _withWeights)
+                bag.weights = weightsData + weightsIdx;
+        });
+
+        processBagsByKernel(srcData, dstData, bags, tableDesc.getDims()[0], errorMsg);
+    } catch (const std::exception& ex) {
+        errorMsg = ex.what();
+    }
+
+    if (!errorMsg.empty()) {
+        if (resp)
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+        return GENERAL_ERROR;
+    }
+
+    return OK;
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
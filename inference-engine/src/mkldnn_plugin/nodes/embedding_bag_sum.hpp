@@ -5,9 +5,13 @@
 #pragma once
 
 #include "base.hpp"
+#include "ie_parallel.hpp"
+#include "common/embedding_bag_kernel.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace InferenceEngine {
@@ -41,6 +45,90 @@ protected:
     template<typename T>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    StatusCode processDataByKernel(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept;
+
+    // Generates the kernel for FP32 and BF16 tables, BF16 table is accepted as is in the latter case
+    void initKernel(const CNNLayer* layer, size_t indexSize);
+
+    template<typename I>
+    struct Bag {
+        const I* indices = nullptr;
+        size_t size = 0lu;
+        const float* weights = nullptr;
+    };
+
+    // Bags are distributed between threads by the number of accumulated rows rather than by the number of bags.
+    // A bag shared by several threads is accumulated by each of them into its own partial row, the partial rows
+    // are summed up after the parallel region. A thread shares at most its first and its last bag.
+    template<typename I>
+    void processBagsByKernel(const uint8_t* srcData, float* dstData, const std::vector<Bag<I>>& bags,
+                             size_t rowsNum, std::string& errorMsg) noexcept {
+        // every bag has an extra work item, so empty bags are zeroed by some thread as well
+        std::vector<size_t> work(bags.size() + 1lu, 0lu);
+        for (size_t i = 0lu; i < bags.size(); i++)
+            work[i + 1lu] = work[i] + bags[i].size + 1lu;
+
+        const int nthr = parallel_get_max_threads();
+        std::vector<std::string> threadErrors(nthr);
+        std::vector<float> partialRows(2lu * nthr * _embDepth);
+        std::vector<size_t> partialBags(2lu * nthr, bags.size());
+
+        auto threadBody = [&](const int ithr, const int nthr) {
+            size_t start(0lu), end(0lu);
+            splitter(work.back(), nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            const size_t bagStart = std::upper_bound(work.begin(), work.end(), start) - work.begin() - 1lu;
+            const size_t bagEnd = std::lower_bound(work.begin(), work.end(), end) - work.begin();
+            for (size_t b = bagStart; b < bagEnd; b++) {
+                const auto& bag = bags[b];
+                // the rows of the bag owned by the thread, the first work item of the bag isn't a row
+                const size_t firstRowItem = work[b] + 1lu;
+                const size_t rowsStart = std::max(start, firstRowItem) - firstRowItem;
+                const size_t rowsEnd = std::max(std::min(end, work[b + 1lu]), firstRowItem) - firstRowItem;
+                for (size_t i = rowsStart; i < rowsEnd; i++) {
+                    if (static_cast<size_t>(bag.indices[i]) >= rowsNum) {
+                        threadErrors[ithr] = "EmbeddingBagSum layer '" + _layerName + "' has invalid embedding bag index: " +
+                            std::to_string(bag.indices[i]);
+                        return;
+                    }
+                }
+
+                float* dst = dstData + b * _embDepth;
+                if (start > work[b] || end < work[b + 1lu]) {
+                    const size_t slot = 2lu * ithr + (b == bagStart ? 0lu : 1lu);
+                    partialBags[slot] = b;
+                    dst = &partialRows[slot * _embDepth];
+                }
+                (*_kernel)(srcData, bag.indices + rowsStart, bag.weights ? bag.weights + rowsStart : nullptr,
+                           dst, rowsEnd - rowsStart);
+            }
+        };
+
+        parallel_nt(nthr, threadBody);
+
+        for (const auto& threadError : threadErrors) {
+            if (!threadError.empty()) {
+                errorMsg = threadError;
+                return;
+            }
+        }
+
+        for (const size_t b : partialBags) {
+            if (b != bags.size())
+                std::fill_n(dstData + b * _embDepth, _embDepth, 0.f);
+        }
+        for (size_t slot = 0lu; slot < partialBags.size(); slot++) {
+            if (partialBags[slot] == bags.size())
+                continue;
+            float* dst = dstData + partialBags[slot] * _embDepth;
+            const float* partial = &partialRows[slot * _embDepth];
+            for (size_t i = 0lu; i < _embDepth; i++)
+                dst[i] += partial[i];
+        }
+    }
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -50,6 +138,7 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+    std::shared_ptr<EmbeddingBagKernel> _kernel;
 
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
     using INT64 = PrecisionTrait<Precision::I64>::value_type;
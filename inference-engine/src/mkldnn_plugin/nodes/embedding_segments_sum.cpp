@@ -42,6 +42,8 @@ public:
 
         _indices = std::vector<size_t>(indicesData->getTensorDesc().getDims()[0], 0lu);
         _segmentIds = std::vector<size_t>(segmentIdData->getTensorDesc().getDims()[0], 0lu);
+
+        initKernel(layer, sizeof(size_t));
     }
 
     void initFromInputs(std::vector<Blob::Ptr>& inputs) override {
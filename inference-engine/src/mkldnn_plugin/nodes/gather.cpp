@@ -10,9 +10,11 @@
 #include <cassert>
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/fp16_utils.h"
+#include "common/gather_kernel.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -68,6 +70,13 @@ public:
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            if (inIdxPrecision == Precision::I32 && indexRange <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                const size_t rowSize = dataLength * dataPrecision.size();
+                kernel = std::make_shared<GatherKernel>(dataPrecision.size(), rowSize, rowSize, false, indexRange * rowSize);
+                if (!kernel->isSupported())
+                    kernel.reset();
+            }
         } catch (InferenceEngine::Exception &ex) {
             errorMsg = ex.what();
         }
@@ -100,7 +109,10 @@ public:
                 gather<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::I32:
-                gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                if (kernel)
+                    gatherByKernel(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                else
+                    gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -138,6 +150,30 @@ private:
         });
     }
 
+    void gatherByKernel(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+        const size_t src_indexSize = indexes->size();
+        const int32_t *src_index = indexes->cbuffer().as<const int32_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
+        const size_t workAmount = numDictionaries * src_indexSize;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(workAmount, nthr, ithr, start, end);
+
+            //  Indices are processed by runs within a single dictionary
+            while (start < end) {
+                const size_t j = start / src_indexSize;
+                const size_t i = start % src_indexSize;
+                const size_t count = std::min(src_indexSize - i, end - start);
+                (*kernel)(&src_dataDict[len * j * indexRange], &src_index[i], &dst_data[len * start], count, static_cast<int32_t>(indexRange));
+                start += count;
+            }
+        });
+    }
+
+    std::shared_ptr<GatherKernel> kernel;
     int axis = 0;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
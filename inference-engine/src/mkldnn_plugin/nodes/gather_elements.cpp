@@ -4,9 +4,13 @@
 
 #include "base.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
+#include "common/gather_kernel.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -76,9 +80,27 @@ public:
         config.dynBatchSupport = false;
 
         confs.push_back(config);
+
+        // Data and output differ only along the axis, so the elements are gathered by runs along the innermost
+        // dimensions: by rows of the axis for the last axis, and with linear offsets within the inner block otherwise
+        srcAxDim_ = dataDims[axis_];
+        innerSize_ = 1;
+        for (size_t i = axis_ + 1; i < dataDims.size(); i++)
+            innerSize_ *= dataDims[i];
+        const size_t srcBlockSize = srcAxDim_ * innerSize_ * dataTypeSize_;
+        if (srcAxDim_ <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            kernel_ = std::make_shared<GatherKernel>(dataTypeSize_, dataTypeSize_, innerSize_ * dataTypeSize_, innerSize_ > 1, srcBlockSize);
+            if (!kernel_->isSupported())
+                kernel_.reset();
+        }
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        if (kernel_) {
+            kernelExecution(inputs, outputs);
+            return OK;
+        }
+
         switch (dataTypeSize_) {
             case sizeof(PrecisionTrait<Precision::I32>::value_type):
                 return directExecution<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
@@ -132,6 +154,36 @@ protected:
         return OK;
     }
 
+    void kernelExecution(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept {
+        const uint8_t* srcData = inputs[dataIndex_]->cbuffer().as<const uint8_t*>() +
+            inputs[dataIndex_]->getTensorDesc().getBlockingDesc().getOffsetPadding() * dataTypeSize_;
+        const int* indices = inputs[indicesIndex_]->cbuffer().as<const int*>() +
+            inputs[indicesIndex_]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t* dstData = outputs[0]->buffer().as<uint8_t*>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * dataTypeSize_;
+
+        // a run is a row of the axis for the last axis, or an inner block otherwise
+        const bool lastAxis = innerSize_ == 1;
+        const size_t runSize = lastAxis ? dstAxDim_ : innerSize_;
+        const size_t srcBlockSize = srcAxDim_ * innerSize_ * dataTypeSize_;
+        const size_t outSize = outputs[0]->size();
+        auto threadBody = [&](const int ithr, const int nthr) {
+            size_t start(0lu), end(0lu);
+            splitter(outSize, nthr, ithr, start, end);
+
+            while (start < end) {
+                const size_t run = start / runSize;
+                const size_t pos = start % runSize;
+                const size_t count = std::min(runSize - pos, end - start);
+                const uint8_t* src = lastAxis ? srcData + run * srcBlockSize :
+                                                srcData + (run / dstAxDim_) * srcBlockSize + pos * dataTypeSize_;
+                (*kernel_)(src, indices + start, dstData + start * dataTypeSize_, count, static_cast<int32_t>(srcAxDim_));
+                start += count;
+            }
+        };
+        parallel_nt(0, threadBody);
+    }
+
     const size_t dataIndex_ = 0;
     const size_t indicesIndex_ = 1;
 
@@ -140,6 +192,9 @@ protected:
     int strideAxDst_;
     int dstAxDim_;
     int strideAx1Diff_;
+    size_t srcAxDim_;
+    size_t innerSize_;
+    std::shared_ptr<GatherKernel> kernel_;
     std::string errorPrefix_;
 };
 
@@ -4,10 +4,14 @@
 
 #include "base.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include "common/gather_kernel.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -82,10 +86,21 @@ public:
         config.dynBatchSupport = false;
 
         confs.push_back(config);
+
+        // Slices addressed by a single index are rows of the data within a batch
+        _indexRange = dataDims[_batchDims];
+        if (_sliceRank == 1 && _indexRange <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            const size_t rowSize = _blockSize * _dataTypeSize;
+            _kernel = std::make_shared<GatherKernel>(_dataTypeSize, rowSize, rowSize, false, _batchStep * _dataTypeSize);
+            if (!_kernel->isSupported())
+                _kernel.reset();
+        }
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        if (_blockSize > 1) {
+        if (_kernel) {
+            gatherRows(inputs, outputs);
+        } else if (_blockSize > 1) {
             gatherBlocks(inputs, outputs, resp);
         } else {
             switch (_dataTypeSize) {
@@ -211,6 +226,34 @@ protected:
         parallel_nt(0, threadBody);
     }
 
+    void gatherRows(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept {
+        const uint8_t* srcData = inputs[_dataIndex]->cbuffer().as<const uint8_t*>() +
+            inputs[_dataIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const int* indices = inputs[_indicesIndex]->cbuffer().as<const int*>() +
+            inputs[_indicesIndex]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t* dstData = outputs[0]->buffer().as<uint8_t*>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const size_t batchStep = _batchStep * _dataTypeSize;
+        const size_t dataStep = _blockSize * _dataTypeSize;
+        const size_t cycles = outputs[0]->byteSize() / (dataStep * _batchNum);
+        const size_t workAmount = _batchNum * cycles;
+
+        auto threadBody = [&](const int ithr, const int nthr) {
+            size_t start(0lu), end(0lu);
+            splitter(workAmount, nthr, ithr, start, end);
+
+            while (start < end) {
+                const size_t b = start / cycles;
+                const size_t count = std::min(cycles - start % cycles, end - start);
+                (*_kernel)(srcData + b * batchStep, indices + start, dstData + start * dataStep, count, static_cast<int32_t>(_indexRange));
+                start += count;
+            }
+        };
+
+        parallel_nt(0, threadBody);
+    }
+
     size_t _dataRank;
     size_t _sliceRank;
     size_t _blockSize;
@@ -218,6 +261,8 @@ protected:
     size_t _batchNum;
     size_t _batchStep;
     size_t _dataTypeSize;
+    size_t _indexRange;
+    std::shared_ptr<GatherKernel> _kernel;
     const size_t _dataIndex = 0;
     const size_t _indicesIndex = 1;
     std::string _errorPrefix;
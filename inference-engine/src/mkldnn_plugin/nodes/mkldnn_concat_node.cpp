@@ -10,6 +10,7 @@
 #include <mkldnn_extension_utils.h>
 
 #include <legacy/ie_layers.h>
+#include <ngraph/op/concat.hpp>
 #include "mkldnn.hpp"
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_dims.h"
@@ -28,16 +29,26 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 MKLDNNConcatNode::MKLDNNConcatNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNNode(layer, eng, cache) {}
-
-void MKLDNNConcatNode::getSupportedDescriptors() {
-    auto * conLayer = dynamic_cast<ConcatLayer*>(getCnnLayer().get());
+        : MKLDNNNode(layer, eng, cache) {
+    auto * conLayer = dynamic_cast<ConcatLayer*>(layer.get());
 
     if (conLayer == nullptr)
         IE_THROW() << "Cannot convert concat layer.";
 
     axis = conLayer->_axis;
+}
+
+MKLDNNConcatNode::MKLDNNConcatNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    auto concatOp = ngraph::as_type_ptr<ngraph::op::v0::Concat>(op);
+    if (concatOp == nullptr)
+        IE_THROW() << "Cannot convert concat operation " << op->get_friendly_name();
 
+    // the axis is normalized during validation of the operation
+    axis = static_cast<size_t>(concatOp->get_concatenation_axis());
+}
+
+void MKLDNNConcatNode::getSupportedDescriptors() {
     if (getParentEdges().empty())
         IE_THROW() << "Incorrect number of input edges for layer " << getName();
     if (getChildEdges().empty())
@@ -64,10 +75,10 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    inputPrecision = getCnnLayer()->insData[0].lock()->getPrecision();
+    inputPrecision = getOriginalInputPrecisionAtPort(0);
     bool isMixedPrecision = false;
-    for (int i = 1; i < getCnnLayer()->insData.size(); i++) {
-        if (getCnnLayer()->insData[0].lock()->getPrecision() != getCnnLayer()->insData[i].lock()->getPrecision()) {
+    for (int i = 1; i < originalInputPrecisions.size(); i++) {
+        if (getOriginalInputPrecisionAtPort(0) != getOriginalInputPrecisionAtPort(i)) {
             isMixedPrecision = true;
             break;
         }
@@ -651,3 +662,4 @@ InferenceEngine::Precision MKLDNNConcatNode::getRuntimePrecision() const {
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNConcatNode, Concatenation);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNConcatNode, Concatenation);
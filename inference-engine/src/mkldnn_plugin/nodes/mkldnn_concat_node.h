@@ -14,6 +14,7 @@ namespace MKLDNNPlugin {
 class MKLDNNConcatNode : public MKLDNNNode {
 public:
     MKLDNNConcatNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    MKLDNNConcatNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     ~MKLDNNConcatNode() override = default;
 
     void getSupportedDescriptors() override;
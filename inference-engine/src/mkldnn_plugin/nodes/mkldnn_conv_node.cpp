@@ -16,6 +16,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include <utils/general_utils.h>
+#include <ngraph_ops/convolution_ie.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -56,6 +57,55 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr&
     if (getCnnLayer()->type == "Convolution") {
         baseInputsNumber = getCnnLayer().get()->insData.size();
     }
+
+    auto * convLayer = dynamic_cast<ConvolutionLayer*>(layer.get());
+    if (convLayer == nullptr)
+        IE_THROW() << "Cannot convert convolution layer.";
+
+    group = convLayer->_group;
+    inputChannels = convLayer->input()->getDims()[1];
+    outputChannels = convLayer->_out_depth;
+    inputLayout = convLayer->input()->getLayout();
+    withBiases = (convLayer->_biases != nullptr && convLayer->_biases->size() != 0) || baseInputsNumber == 3;
+
+    for (int i = 1; i <= convLayer->_kernel.size(); i++) {
+        kernel.push_back(convLayer->_kernel[convLayer->_kernel.size() - i]);
+    }
+    invertVectorCopyUtoI(convLayer->_stride, stride);
+    for (int i = 1; i <= convLayer->_dilation.size(); i++) {
+        dilation.push_back(static_cast<int>(convLayer->_dilation[convLayer->_dilation.size() - i]) - 1);
+    }
+
+    auto allPads = getPaddings(*convLayer);
+    invertVectorCopyUtoI(allPads.begin, paddingL);
+    invertVectorCopyUtoI(allPads.end, paddingR);
+}
+
+MKLDNNConvolutionNode::MKLDNNConvolutionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache), withBiases(false), withSum(false), withDWConv(false), isDW(false), isMerged(false),
+          isGrouped(false), dw_conv_oc(0), dw_conv_ih(0), dw_conv_iw(0), dw_conv_in_dt(memory::data_type::undef),
+          groupNum(1lu), baseInputsNumber(1), eltwisePrecision(Precision::FP32) {
+    auto convOp = ngraph::as_type_ptr<ngraph::op::ConvolutionIE>(op);
+    if (convOp == nullptr)
+        IE_THROW() << "Cannot convert convolution operation " << op->get_friendly_name();
+
+    // weights and biases are not copied into internal blobs, they come as the Constant inputs of the node
+    baseInputsNumber = static_cast<int>(op->get_input_size());
+    withBiases = baseInputsNumber == 3;
+
+    group = convOp->get_group();
+    inputChannels = op->get_input_shape(0)[1];
+    outputChannels = op->get_output_shape(0)[1];
+    inputLayout = TensorDesc::getLayoutByDims(op->get_input_shape(0));
+
+    const auto& weightsShape = op->get_input_shape(1);
+    kernel.assign(weightsShape.begin() + 2, weightsShape.end());
+    stride.assign(convOp->get_strides().begin(), convOp->get_strides().end());
+    for (auto d : convOp->get_dilations()) {
+        dilation.push_back(static_cast<ptrdiff_t>(d) - 1);
+    }
+    paddingL.assign(convOp->get_pads_begin().begin(), convOp->get_pads_begin().end());
+    paddingR.assign(convOp->get_pads_end().begin(), convOp->get_pads_end().end());
 }
 
 mkldnn::memory::data_type MKLDNNConvolutionNode::precisionToDataType(InferenceEngine::Precision prec) {
@@ -67,18 +117,14 @@ mkldnn::memory::data_type MKLDNNConvolutionNode::precisionToDataType(InferenceEn
 }
 
 bool MKLDNNConvolutionNode::canBeExecutedInInt8() {
-    auto * convLayer = dynamic_cast<ConvolutionLayer*>(getCnnLayer().get());
-    if (convLayer == nullptr)
-        IE_THROW() << "Cannot convert convolution layer.";
-
     if (baseInputsNumber > 1) {
-        auto inputDataType = precisionToDataType(getCnnLayer()->insData[0].lock()->getPrecision());
+        auto inputDataType = precisionToDataType(getOriginalInputPrecisionAtPort(0));
         if (!inputZeroPoints.empty())
             inputDataType = memory::data_type::u8;
 
         auto weightsDataType = precisionToDataType(Precision::FP32);
         if (baseInputsNumber > 1) {
-            weightsDataType = precisionToDataType(getCnnLayer()->insData[1].lock()->getPrecision());
+            weightsDataType = precisionToDataType(getOriginalInputPrecisionAtPort(1));
             if (!weightsZeroPoints.empty())
                 weightsDataType = memory::data_type::s8;
         }
@@ -104,10 +150,6 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
-    auto * convLayer = dynamic_cast<ConvolutionLayer*>(getCnnLayer().get());
-    if (convLayer == nullptr)
-        IE_THROW() << "Cannot convert convolution layer.";
-
     withSum = false;
     int expectedInputEdgesNum = baseInputsNumber;
     for (int i = 0; i < fusedWith.size(); i++) {
@@ -123,11 +165,11 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         }
     }
 
-    auto inputDataType = precisionToDataType(getCnnLayer()->insData[0].lock()->getPrecision());
+    auto inputDataType = precisionToDataType(getOriginalInputPrecisionAtPort(0));
     if (!inputZeroPoints.empty())
         inputDataType = memory::data_type::u8;
 
-    auto outputDataType = precisionToDataType(getCnnLayer()->outData[0]->getPrecision());
+    auto outputDataType = precisionToDataType(getOriginalOutputPrecisionAtPort(0));
     eltwisePrecision = MKLDNNExtensionUtils::DataTypeToIEPrecision(outputDataType);
     if (baseInputsNumber > 1) {
         if (!fusedWith.empty()) {
@@ -165,15 +207,15 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
     }
 
     isMerged = (!getMergeWith().empty());  // grouped convolution was constructed from split->concat subgraph
-    isGrouped = convLayer->_group != 1;    // group info available from IR
+    isGrouped = group != 1;    // group info available from IR
     if (isMerged && isGrouped)
         IE_THROW() << "Convolution initialization. Group splitted mode are used together with direct group specification.";
 
     // default values. Can be replaced in next steps
-    groupNum = convLayer->_group;
-    size_t IC = convLayer->input()->getDims()[1];
+    groupNum = group;
+    size_t IC = inputChannels;
     size_t groupIC = IC;
-    size_t groupOC = convLayer->_out_depth;
+    size_t groupOC = outputChannels;
 
     isDW = groupNum == groupOC && groupNum == groupIC;
 
@@ -188,15 +230,11 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
     weightDims.clear();
     weightDims.push_back(groupOC);
     weightDims.push_back(groupIC);
-    for (int i = 1; i <= convLayer->_kernel.size(); i++) {
-        weightDims.push_back(convLayer->_kernel[convLayer->_kernel.size() - i]);
-    }
+    weightDims.insert(weightDims.end(), kernel.begin(), kernel.end());
     biasesDims = { groupOC * groupNum };
 
     if (isGrouped || isMerged) weightDims.insert(weightDims.begin(), groupNum);
 
-    withBiases = (convLayer->_biases != nullptr && convLayer->_biases->size() != 0) || baseInputsNumber == 3;
-
     if (baseInputsNumber == 1) {
         internalBlobs.push_back(createInternalBlob(weightDims, true, isGrouped));
 
@@ -226,15 +264,6 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         }
     }
 
-    invertVectorCopyUtoI(convLayer->_stride, stride);
-    for (int i = 1; i <= convLayer->_dilation.size(); i++) {
-        dilation.push_back(static_cast<int>(convLayer->_dilation[convLayer->_dilation.size() - i]) - 1);
-    }
-
-    auto allPads = getPaddings(*convLayer);
-    invertVectorCopyUtoI(allPads.begin, paddingL);
-    invertVectorCopyUtoI(allPads.end, paddingR);
-
     MKLDNNDims weightsDims = MKLDNNDims(weightDims);
 
     withDWConv = isFusedWith(Convolution);
@@ -284,9 +313,9 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
                 getParentEdgeAt(0)->getDims().ndims() == 5 ? memory::format_tag::ndhwc : memory::format_tag::nhwc);
         createDescriptor({in_candidate}, {out_candidate});
     } else {
-        inputDataType = (convLayer->input()->getPrecision() == Precision::BF16
+        inputDataType = (getOriginalInputPrecisionAtPort(0) == Precision::BF16
         && !(isGrouped && getParentEdgeAt(0)->getDims().ndims() == 5)) ? memory::data_type::bf16 : memory::data_type::f32;
-        outputDataType = (convLayer->outData[0]->getPrecision() == Precision::BF16
+        outputDataType = (getOriginalOutputPrecisionAtPort(0) == Precision::BF16
         && !(isGrouped && getParentEdgeAt(0)->getDims().ndims() == 5)) ? memory::data_type::bf16 : memory::data_type::f32;
         eltwisePrecision = Precision::FP32;
         for (int i = 0; i < fusedWith.size(); i++) {
@@ -310,7 +339,7 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
             eltwisePrecision = Precision::FP32;
         }
 
-        Layout layout = convLayer->input()->getLayout();
+        Layout layout = inputLayout;
 
         if (layout == NCHW || layout == NHWC) {
             if (IC == 1 && groupOC == 1) {
@@ -610,7 +639,7 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
 
     if (inDesc.getPrecision() == Precision::U8 || inDesc.getPrecision() == Precision::I8) {
         wdt = memory::data_type::s8;
-        bdt = baseInputsNumber == 3 ? precisionToDataType(getCnnLayer()->insData[2].lock()->getPrecision()) : memory::data_type::s32;
+        bdt = baseInputsNumber == 3 ? precisionToDataType(getOriginalInputPrecisionAtPort(2)) : memory::data_type::s32;
     }
 
     if (baseInputsNumber == 1) {
@@ -722,9 +751,9 @@ void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& c
     // Strided blobs feature support.
     // Works only for FP32 convolutions for now.
     bool isStridedBlobsSupported = true;
-    for (auto &insData : getCnnLayer()->insData) {
-        if (insData.lock()->getPrecision() != InferenceEngine::Precision::FP32
-            && insData.lock()->getPrecision() != InferenceEngine::Precision::BF16) {
+    for (const auto &precision : originalInputPrecisions) {
+        if (precision != InferenceEngine::Precision::FP32
+            && precision != InferenceEngine::Precision::BF16) {
             isStridedBlobsSupported = false;
             break;
         }
@@ -857,7 +886,7 @@ bool MKLDNNConvolutionNode::isPossibleToSkipInitConfig(MKLDNNDescriptor &desc) {
     if (!inputMemoryFormatsFilter.empty() || !outputMemoryFormatsFilter.empty())
         return false;
 
-    if (getCnnLayer()->params.find("PrimitivesPriority") != getCnnLayer()->params.end())
+    if (!implPriorities.empty())
         return false;
 
     //  Here we check that we will not delete jit_planar_conv primitive by mistake.
@@ -940,3 +969,4 @@ InferenceEngine::Precision MKLDNNConvolutionNode::getRuntimePrecision() const {
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNConvolutionNode, Convolution);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNConvolutionNode, Convolution);
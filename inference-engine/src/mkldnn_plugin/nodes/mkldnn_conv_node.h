@@ -17,6 +17,7 @@ class MKLDNNEltwiseNode;
 class MKLDNNConvolutionNode : public MKLDNNNode {
 public:
     MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    MKLDNNConvolutionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     ~MKLDNNConvolutionNode() override = default;
 
     void getSupportedDescriptors() override;
@@ -70,6 +71,11 @@ private:
     bool isDW;
     bool isMerged;
     bool isGrouped;
+    size_t group;
+    size_t inputChannels;
+    size_t outputChannels;
+    InferenceEngine::Layout inputLayout;
+    std::vector<ptrdiff_t> kernel;
     std::vector<ptrdiff_t> stride;
     std::vector<ptrdiff_t> dilation;
     std::vector<ptrdiff_t> paddingL;
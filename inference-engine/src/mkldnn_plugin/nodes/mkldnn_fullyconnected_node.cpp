@@ -5,12 +5,16 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_quantize_node.h"
+#include "common/weights_decompression_gemm.h"
 
 #include <legacy/ie_layers.h>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
 #include "utils/general_utils.h"
 
 using namespace mkldnn;
@@ -120,6 +124,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    // compressed weights are not supported by mkldnn inner product, the descriptors are set up manually
+    if (withWeightsDecompression())
+        return;
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -128,7 +136,103 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto planarDesc = [](Precision precision, const MKLDNNDims& dims) {
+        const auto dimsVector = dims.ToSizeVector();
+        return TensorDesc(precision, dimsVector, TensorDesc::getLayoutByDims(dimsVector));
+    };
+
+    LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        // the weights are taken in their original 8-bits precision right from the constant
+        const Precision precision = i == 1 ? getParentEdgeAt(1)->getParent()->getCnnLayer()->outData[0]->getPrecision() : Precision::FP32;
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = i > 0;
+        dataConfig.desc = planarDesc(precision, getParentEdgeAt(i)->getDims());
+        config.inConfs.push_back(dataConfig);
+    }
+    DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = planarDesc(Precision::FP32, getChildEdgeAt(0)->getDims());
+    config.outConfs.push_back(dataConfig);
+
+    const impl_desc_type implType = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    supportedPrimitiveDescriptors.emplace_back(config, implType, MKLDNNMemoryDesc(config.outConfs[0].desc).getFormat());
+}
+
+bool MKLDNNFullyConnectedNode::isWeightsDecompressionSupported() {
+    return WeightsDecompressionGemm::isSupportedByPlatform();
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(std::vector<float> scale, std::vector<float> shift, bool transposed) {
+    decompressionScale = std::move(scale);
+    decompressionShift = std::move(shift);
+    transposedCompressedWeights = transposed;
+}
+
+void MKLDNNFullyConnectedNode::prepareDecompressedWeights() {
+    const auto& weightsMemory = getParentEdgeAt(1)->getMemory();
+    const Precision precision = MKLDNNExtensionUtils::DataTypeToIEPrecision(weightsMemory.GetDataType());
+    const size_t N = weightsDims[0];
+    const size_t K = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const void* weights = weightsMemory.GetPtr();
+
+    decompressionGemm = std::make_shared<WeightsDecompressionGemm>(precision, N, K, WeightsDecompressionGemm::fitsInt4(weights, precision, N * K));
+    if (!decompressionGemm->isSupported())
+        IE_THROW() << "FullyConnected node with name '" << getName() << "' cannot create kernel for compressed weights";
+
+    auto create = [&] () {
+        MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        const MKLDNNMemoryDesc packedDesc(MKLDNNDims({static_cast<ptrdiff_t>(decompressionGemm->packedSize())}),
+                                          memory::data_type::u8, memory::format_tag::x);
+        if (weightCache != nullptr)
+            _ptr->CreateOnNumaNode(packedDesc, weightCache->GetNumaNodeId());
+        else
+            _ptr->Create(packedDesc);
+        // the weights are [N, K] or [K, N] if they were transposed
+        decompressionGemm->pack(weights, transposedCompressedWeights ? 1 : K, transposedCompressedWeights ? N : 1,
+                                decompressionScale, decompressionShift, static_cast<uint8_t*>(_ptr->GetData()));
+        return _ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const size_t weightsSize = N * K * sizeof(uint8_t);
+        const std::string string_hash = getName() + "_decompression_" + std::to_string(weightsSize)
+                                        + "_" + std::to_string(weightCache->GetHashFunc().hash(weights, weightsSize));
+        packedWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packedWeights = create();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithWeightsDecompression() {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t K = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t M = srcMemory.GetElementsCount() / K;
+
+    const auto* bias = withBiases ? static_cast<const float*>(getParentEdgeAt(2)->getMemory().GetPtr()) : nullptr;
+    (*decompressionGemm)(static_cast<const float*>(srcMemory.GetPtr()), M, static_cast<const uint8_t*>(packedWeights->GetData()),
+                         bias, static_cast<float*>(dstMemory.GetPtr()));
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withWeightsDecompression()) {
+        if (!decompressionGemm)
+            prepareDecompressedWeights();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -148,7 +252,9 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (withWeightsDecompression()) {
+        executeWithWeightsDecompression();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -301,6 +407,9 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    if (withWeightsDecompression())
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 
+class WeightsDecompressionGemm;
+
 namespace MKLDNNPlugin {
 
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
@@ -19,6 +21,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +46,18 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    static bool isWeightsDecompressionSupported();
+
+    /**
+     * Makes the node take I8/U8 weights from the 2nd input as is and dequantize them on the fly:
+     * w[n][k] = q[n][k] * scale[n] + shift[n]. Scale and shift have either one element per output or a single one.
+     * Transposed weights are given as [K, N] instead of [N, K].
+     */
+    void setWeightsDecompression(std::vector<float> scale, std::vector<float> shift, bool transposed);
+    bool withWeightsDecompression() const {
+        return !decompressionScale.empty();
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +70,15 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    void prepareDecompressedWeights();
+    void executeWithWeightsDecompression();
+
+    std::vector<float> decompressionScale;
+    std::vector<float> decompressionShift;
+    bool transposedCompressedWeights = false;
+    std::shared_ptr<WeightsDecompressionGemm> decompressionGemm;
+    MKLDNNMemoryPtr packedWeights;
 };
 
 }  // namespace MKLDNNPlugin
@@ -10,6 +10,8 @@
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
+#include <blob_factory.hpp>
+#include <ie_ngraph_utils.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -28,6 +30,45 @@ MKLDNNInputNode::MKLDNNInputNode(const InferenceEngine::CNNLayerPtr& layer, cons
     }
 }
 
+MKLDNNInputNode::MKLDNNInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    if (getType() == Output) {
+        // the output of Result isn't a data of the graph
+        outDims.clear();
+        originalOutputPrecisions.clear();
+    }
+
+    constant = ConstantType::NoConst;
+    constOp = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op);
+    if (constOp) {
+        constant = ConstantType::Const;
+
+        // the blob refers to the data of the constant, so weights aren't copied until the node is executed
+        auto dataPrecision = getOriginalOutputPrecisionAtPort(0);
+        size_t shapeSize = ngraph::shape_size(constOp->get_shape());
+        constexpr size_t byte_size{8};
+        if (dataPrecision == InferenceEngine::Precision::BIN) {
+            shapeSize = (shapeSize + (byte_size - 1)) / byte_size;
+        }
+        InferenceEngine::TensorDesc td(dataPrecision, {shapeSize}, InferenceEngine::Layout::C);
+        constBlob = make_blob_with_precision(td, const_cast<void*>(constOp->get_data_ptr()));
+    }
+}
+
+InferenceEngine::TensorDesc MKLDNNInputNode::getOriginalDesc() const {
+    if (getType() == Output) {
+        if (getCnnLayer())
+            return getCnnLayer()->insData[0].lock()->getTensorDesc();
+        auto dims = inDims[0].ToSizeVector();
+        return InferenceEngine::TensorDesc(getOriginalInputPrecisionAtPort(0), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+    }
+
+    if (getCnnLayer())
+        return getCnnLayer()->outData[0]->getTensorDesc();
+    auto dims = outDims[0].ToSizeVector();
+    return InferenceEngine::TensorDesc(getOriginalOutputPrecisionAtPort(0), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+}
+
 void MKLDNNInputNode::getSupportedDescriptors() {
     if (getType() == Input) {
         if (!getParentEdges().empty())
@@ -49,7 +90,7 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
     if (getType() == Input || getType() == MemoryInput) {
-        precision = getCnnLayer()->outData[0]->getPrecision();
+        precision = getOriginalOutputPrecisionAtPort(0);
         if (precision == InferenceEngine::Precision::U16 || isMeanImage) {
             precision = InferenceEngine::Precision::FP32;
         }
@@ -57,17 +98,17 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
         dataConfig.inPlace = -1;
         dataConfig.constant = false;
 
-        auto mem_tdesc = MKLDNNMemoryDesc(getCnnLayer()->outData[0]->getTensorDesc());
+        auto mem_tdesc = MKLDNNMemoryDesc(getOriginalDesc());
         dataConfig.desc = mem_tdesc;
         config.outConfs.push_back(dataConfig);
     } else if (getType() == Output) {
-        precision = getCnnLayer()->insData[0].lock()->getPrecision();
+        precision = getOriginalInputPrecisionAtPort(0);
         if (precision == InferenceEngine::Precision::U16) precision = InferenceEngine::Precision::FP32;
         InferenceEngine::DataConfig dataConfig;
         dataConfig.inPlace = -1;
         dataConfig.constant = false;
 
-        auto mem_tdesc = MKLDNNMemoryDesc(getCnnLayer()->insData[0].lock()->getTensorDesc());
+        auto mem_tdesc = MKLDNNMemoryDesc(getOriginalDesc());
         dataConfig.desc = mem_tdesc;
         config.inConfs.push_back(dataConfig);
     }
@@ -172,3 +213,5 @@ void MKLDNNInputNode::execute(mkldnn::stream strm) {
 
 REG_MKLDNN_PRIM_FOR(MKLDNNInputNode, Input);
 REG_MKLDNN_PRIM_FOR(MKLDNNInputNode, Output);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNInputNode, Input);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNInputNode, Output);
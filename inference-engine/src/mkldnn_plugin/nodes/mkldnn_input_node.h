@@ -6,6 +6,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <ngraph/op/constant.hpp>
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
@@ -13,6 +15,7 @@ namespace MKLDNNPlugin {
 class MKLDNNInputNode : public MKLDNNNode {
 public:
     MKLDNNInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    MKLDNNInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     ~MKLDNNInputNode() override = default;
 
     void getSupportedDescriptors() override;
@@ -26,9 +29,13 @@ public:
     }
 
 private:
+    InferenceEngine::TensorDesc getOriginalDesc() const;
+
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
+    // keeps the data constBlob points to when the node is created from ngraph
+    std::shared_ptr<ngraph::op::v0::Constant> constOp;
     bool isMeanImage = false;
 };
 
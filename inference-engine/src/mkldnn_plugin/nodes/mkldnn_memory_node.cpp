@@ -3,9 +3,12 @@
 //
 
 #include <string>
+#include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
 
 using namespace mkldnn;
@@ -47,6 +50,9 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
     auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
+    // the new state is already written to the external memory by the parent node
+    if (inputMemoryNode->hasExternalState())
+        return;
     inputMemoryNode->storeState(srcMemory);
 }
 
@@ -101,6 +107,9 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    // the child nodes read the external state memory directly
+    if (externalState)
+        return;
     auto dst_mem = getChildEdgeAt(0)->getMemory();
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
@@ -108,6 +117,83 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     simple_copy(dst_mem, *dataStore);
 }
 
+/**
+ * Collects the child edges of the node sharing the given data pointer.
+ * @return false if the memory can't be replaced: the node or the children keep their own pointers to the data
+ */
+static bool collectAliasEdges(const MKLDNNNodePtr& node, void* ptr, std::vector<MKLDNNEdgePtr>& aliases) {
+    if (node->isConstant() || node->isInplace())
+        return false;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        if (edge->getMemory().GetPrimitivePtr()->get_data_handle() != ptr)
+            continue;
+        auto& child = edge->getChild();
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        // outputs are switched to the user memory by the infer request, so the data pointer isn't owned by the graph
+        if (child->isInplace() || (concat && concat->isOptimized()) || split || child->getType() == Output)
+            return false;
+        aliases.push_back(edge);
+    }
+    return !aliases.empty();
+}
+
+bool MKLDNNMemoryInputNode::initExternalStateEdges() {
+    if (outputNode == nullptr || outputNode->getParentEdges().size() != 1)
+        return false;
+
+    auto stateEdge = getChildEdgeAt(0);
+    auto newStateEdge = outputNode->getParentEdgeAt(0);
+    auto producer = newStateEdge->getParent();
+    // the state passed through as is can't be read and written to different buffers
+    if (producer.get() == this)
+        return false;
+    if (!(stateEdge->getDesc() == newStateEdge->getDesc()) || stateEdge->getMemory().GetSize() != dataStore->GetSize())
+        return false;
+
+    auto statePtr = stateEdge->getMemory().GetPrimitivePtr()->get_data_handle();
+    auto newStatePtr = newStateEdge->getMemory().GetPrimitivePtr()->get_data_handle();
+    auto self = getChildEdgeAt(0)->getParent();
+    if (!collectAliasEdges(self, statePtr, stateEdges) || !collectAliasEdges(producer, newStatePtr, newStateEdges)) {
+        stateEdges.clear();
+        newStateEdges.clear();
+        return false;
+    }
+    for (auto& edge : stateEdges)
+        defaultPtrs.push_back(edge->getMemory().GetPrimitivePtr()->get_data_handle());
+    for (auto& edge : newStateEdges)
+        defaultPtrs.push_back(edge->getMemory().GetPrimitivePtr()->get_data_handle());
+    return true;
+}
+
+bool MKLDNNMemoryInputNode::setExternalState(void* state, void* newState) {
+    if (externalStateSupport == ExternalStateSupport::Unknown)
+        externalStateSupport = initExternalStateEdges() ? ExternalStateSupport::Supported : ExternalStateSupport::Unsupported;
+    if (externalStateSupport == ExternalStateSupport::Unsupported || state == nullptr || newState == nullptr || state == newState) {
+        resetExternalState();
+        return false;
+    }
+
+    for (auto& edge : stateEdges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(state);
+    for (auto& edge : newStateEdges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(newState);
+    externalState = true;
+    return true;
+}
+
+void MKLDNNMemoryInputNode::resetExternalState() {
+    if (!externalState)
+        return;
+    size_t i = 0;
+    for (auto& edge : stateEdges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(defaultPtrs[i++]);
+    for (auto& edge : newStateEdges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(defaultPtrs[i++]);
+    externalState = false;
+}
+
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
     std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
     // in case of output already registered
@@ -117,6 +203,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(
         auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -132,6 +219,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput
         auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
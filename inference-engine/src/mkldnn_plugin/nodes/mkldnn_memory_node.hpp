@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -96,11 +97,44 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Makes the graph read the state from the given memory and write the new state to the other one,
+     * so the state is passed between inferences without copies
+     * @return false if the edges of the state can't be switched to external memory, the store is used then
+     */
+    bool setExternalState(void* state, void* newState);
+    /**
+     * @brief Switches the edges of the state back to the graph memory, the state is copied through the store
+     */
+    void resetExternalState();
+    bool hasExternalState() const {
+        return externalState;
+    }
+
  private:
+    bool initExternalStateEdges();
+
     MKLDNNMemoryPtr dataStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
+
+    // edges sharing the memory of the state read by the graph and of the new state written by the graph
+    std::vector<MKLDNNEdgePtr> stateEdges;
+    std::vector<MKLDNNEdgePtr> newStateEdges;
+    std::vector<void*> defaultPtrs;
+    enum class ExternalStateSupport {
+        Unknown,
+        Supported,
+        Unsupported
+    };
+    ExternalStateSupport externalStateSupport = ExternalStateSupport::Unknown;
+    bool externalState = false;
 };
 
 }  // namespace MKLDNNPlugin
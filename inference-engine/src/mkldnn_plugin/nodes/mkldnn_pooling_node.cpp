@@ -15,14 +15,56 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include <utils/general_utils.h>
+#include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+template <typename PoolingOp>
+void getPoolingAttributes(const PoolingOp& op, std::vector<ptrdiff_t>& stride, std::vector<ptrdiff_t>& kernel,
+                          std::vector<ptrdiff_t>& padBegin, std::vector<ptrdiff_t>& padEnd) {
+    stride.assign(op.get_strides().begin(), op.get_strides().end());
+    kernel.assign(op.get_kernel().begin(), op.get_kernel().end());
+    padBegin.assign(op.get_pads_begin().begin(), op.get_pads_begin().end());
+    padEnd.assign(op.get_pads_end().begin(), op.get_pads_end().end());
+}
+}  // namespace
+
 MKLDNNPoolingNode::MKLDNNPoolingNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
         MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNNode(layer, eng, cache) {}
+        : MKLDNNNode(layer, eng, cache) {
+    auto * poolingLayer = dynamic_cast<PoolingLayer*>(layer.get());
+    if (poolingLayer == nullptr)
+        IE_THROW() << "Cannot convert pooling layer.";
+
+    type = poolingLayer->_type;
+    exclude_pad = poolingLayer->_exclude_pad;
+    // Dirty WA to support stat based quantization approach
+    statQuantized = poolingLayer->precision == Precision::I8;
+
+    invertVectorCopyUtoI(poolingLayer->_stride, stride);
+    invertVectorCopyUtoI(poolingLayer->_kernel, kernel);
+    auto allPads = getPaddings(*poolingLayer);
+    invertVectorCopyUtoI(allPads.begin, data_pad_begin);
+    invertVectorCopyUtoI(allPads.end, data_pad_end);
+}
+
+MKLDNNPoolingNode::MKLDNNPoolingNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    if (auto maxPoolOp = ngraph::as_type_ptr<ngraph::op::v1::MaxPool>(op)) {
+        type = PoolingLayer::MAX;
+        getPoolingAttributes(*maxPoolOp, stride, kernel, data_pad_begin, data_pad_end);
+    } else if (auto avgPoolOp = ngraph::as_type_ptr<ngraph::op::v1::AvgPool>(op)) {
+        type = PoolingLayer::AVG;
+        exclude_pad = avgPoolOp->get_exclude_pad();
+        getPoolingAttributes(*avgPoolOp, stride, kernel, data_pad_begin, data_pad_end);
+    } else {
+        IE_THROW() << "Cannot convert pooling operation " << op->get_friendly_name();
+    }
+}
 
 std::vector<memory::format_tag> MKLDNNPoolingNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
     if (dims.ndims() == 0)
@@ -44,23 +86,14 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
-    auto * poolingLayer = dynamic_cast<PoolingLayer*>(getCnnLayer().get());
-    if (poolingLayer == nullptr)
-        IE_THROW() << "Cannot convert pooling layer.";
-
     if (getParentEdges().size() != 1)
         IE_THROW() << "Incorrect number of input edges for layer " << getName();
     if (getChildEdges().empty())
         IE_THROW() << "Incorrect number of output edges for layer " << getName();
 
-    type = poolingLayer->_type;
-    exclude_pad = poolingLayer->_exclude_pad;
-
-    inputPrecision = getCnnLayer()->insData[0].lock()->getPrecision();
-    outputPrecision = getCnnLayer()->outData[0]->getPrecision();
-    // Dirty WA to support stat based quantization approach
-    if (this->getCnnLayer()->precision != Precision::I8
-        && inputPrecision != Precision::BF16) {
+    inputPrecision = getOriginalInputPrecisionAtPort(0);
+    outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (!statQuantized && inputPrecision != Precision::BF16) {
         if (type == PoolingLayer::MAX) {
             // MKLDNN supports only equal precisions for input and output
             outputPrecision = inputPrecision;
@@ -82,11 +115,6 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
 
-    invertVectorCopyUtoI(poolingLayer->_stride, stride);
-    invertVectorCopyUtoI(poolingLayer->_kernel, kernel);
-    auto allPads = getPaddings(*poolingLayer);
-    invertVectorCopyUtoI(allPads.begin, data_pad_begin);
-    invertVectorCopyUtoI(allPads.end, data_pad_end);
     effective_pad_begin = data_pad_begin;
     effective_pad_end.resize(data_pad_end.size());
 
@@ -341,3 +369,4 @@ void MKLDNNPoolingNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNPoolingNode, Pooling);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNPoolingNode, Pooling);
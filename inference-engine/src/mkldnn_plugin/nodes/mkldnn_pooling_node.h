@@ -15,6 +15,7 @@ namespace MKLDNNPlugin {
 class MKLDNNPoolingNode : public MKLDNNNode {
 public:
     MKLDNNPoolingNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    MKLDNNPoolingNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     ~MKLDNNPoolingNode() override = default;
 
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
@@ -34,6 +35,7 @@ private:
 
     InferenceEngine::PoolingLayer::PoolType type = InferenceEngine::PoolingLayer::MAX;
     bool exclude_pad = false;
+    bool statQuantized = false;
     std::vector<ptrdiff_t> stride;
     std::vector<ptrdiff_t> kernel;
 
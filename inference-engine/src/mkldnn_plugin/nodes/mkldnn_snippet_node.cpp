@@ -0,0 +1,283 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <mkldnn_extension_utils.h>
+#include "common/tensor_desc_creator.h"
+#include "emitters/cpu_generator.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#define THROW_ERROR IE_THROW() << getTypeStr() << " layer with name '" << getName() <<"' ERROR: "
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+cpu_isa_t getHostIsa() {
+    if (mayiuse(avx512_common)) {
+        return avx512_common;
+    } else if (mayiuse(avx2)) {
+        return avx2;
+    } else if (mayiuse(sse41)) {
+        return sse41;
+    }
+    return isa_any;
+}
+
+// Aligns the ranks of the arguments. Returns false if the outputs don't share the shape or the inputs aren't
+// numpy broadcasted to it
+bool alignDims(std::vector<SizeVector>& dims, size_t inputsCount) {
+    size_t rank = 1;
+    for (const auto& d : dims)
+        rank = std::max(rank, d.size());
+    for (auto& d : dims)
+        d.insert(d.begin(), rank - d.size(), 1);
+
+    const auto& domain = dims.back();
+    if (std::find(domain.begin(), domain.end(), 0) != domain.end())
+        return false;
+    for (size_t i = inputsCount; i < dims.size(); i++) {
+        if (dims[i] != domain)
+            return false;
+    }
+    for (size_t i = 0; i < inputsCount; i++) {
+        for (size_t k = 0; k < rank; k++) {
+            if (dims[i][k] != domain[k] && dims[i][k] != 1)
+                return false;
+        }
+    }
+    return true;
+}
+
+ngraph::snippets::op::Subgraph::BlockedShapeVector getPlanarShapes(const std::vector<SizeVector>& dims) {
+    ngraph::snippets::op::Subgraph::BlockedShapeVector shapes;
+    for (const auto& d : dims) {
+        ngraph::Shape shape(d);
+        ngraph::AxisVector order(shape.size());
+        std::iota(order.begin(), order.end(), 0);
+        shapes.emplace_back(shape, order, ngraph::element::f32);
+    }
+    return shapes;
+}
+
+}  // namespace
+
+bool MKLDNNSnippetNode::isSupported(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
+    const auto isa = getHostIsa();
+    if (isa == isa_any || subgraph->get_input_size() + subgraph->get_output_size() > SNIPPETS_MAX_ARGS ||
+        !CPUGenerator(isa).isSupported(subgraph->get_body()))
+        return false;
+
+    std::vector<SizeVector> inputDims, outputDims;
+    for (const auto& input : subgraph->inputs()) {
+        if (input.get_partial_shape().is_dynamic() || input.get_element_type() != ngraph::element::f32)
+            return false;
+        inputDims.push_back(input.get_shape());
+    }
+    for (const auto& output : subgraph->outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type() != ngraph::element::f32)
+            return false;
+        outputDims.push_back(output.get_shape());
+    }
+    auto dims = inputDims;
+    dims.insert(dims.end(), outputDims.begin(), outputDims.end());
+    if (!alignDims(dims, inputDims.size()))
+        return false;
+
+    // the registers are allocated for the particular body, so the kernel is generated to find out if there are enough
+    try {
+        auto snippet = subgraph->make_canonical_from_this();
+        snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+        snippet->generate(getPlanarShapes(outputDims), getPlanarShapes(inputDims));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(layer, eng, cache) {
+    snippetRef = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!snippetRef)
+        THROW_ERROR << "Subgraph operation isn't found";
+}
+
+void MKLDNNSnippetNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != snippetRef->get_input_size())
+        THROW_ERROR << "Incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "Incorrect number of output edges";
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (!prepareSchedule())
+        THROW_ERROR << "Unsupported shapes of the arguments";
+
+    // the snippet body is generated for the planar layout only
+    auto creator = TensorDescCreator::getCommonCreators().at(TensorDescCreatorTypes::ncsp);
+
+    LayerConfig config;
+    config.dynBatchSupport = false;
+    for (const auto& dims : inDims) {
+        DataConfig dataConfig;
+        dataConfig.desc = creator->createDesc(Precision::FP32, dims.ToSizeVector());
+        config.inConfs.push_back(dataConfig);
+    }
+    for (const auto& dims : outDims) {
+        DataConfig dataConfig;
+        dataConfig.desc = creator->createDesc(Precision::FP32, dims.ToSizeVector());
+        config.outConfs.push_back(dataConfig);
+    }
+
+    const auto isa = getHostIsa();
+    const impl_desc_type implType = isa == avx512_common ? impl_desc_type::jit_avx512 :
+                                    isa == avx2 ? impl_desc_type::jit_avx2 : impl_desc_type::jit_sse42;
+    supportedPrimitiveDescriptors.emplace_back(config, implType, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+}
+
+bool MKLDNNSnippetNode::prepareSchedule() {
+    std::vector<SizeVector> dims;
+    for (const auto& inDim : inDims)
+        dims.push_back(inDim.ToSizeVector());
+    for (const auto& outDim : outDims)
+        dims.push_back(outDim.ToSizeVector());
+
+    // all outputs share the iteration domain, inputs are numpy broadcasted to it
+    if (!alignDims(dims, inDims.size()))
+        return false;
+    const size_t rank = dims.back().size();
+    const auto domain = dims.back();
+
+    innerStrides.clear();
+    for (const auto& d : dims)
+        innerStrides.push_back(d.back() == domain.back() ? 1 : 0);
+
+    // outer dimensions are collapsed into the innermost one while the data stays contiguous for all the arguments
+    innerSize = domain.back();
+    int outerRank = static_cast<int>(rank) - 1;
+    while (outerRank > 0) {
+        const size_t k = outerRank - 1;
+        bool collapsible = true;
+        for (size_t i = 0; i < dims.size(); i++) {
+            collapsible = collapsible && (innerStrides[i] ? dims[i][k] == domain[k] : dims[i][k] == 1);
+        }
+        if (!collapsible)
+            break;
+        innerSize *= domain[k];
+        outerRank--;
+    }
+
+    outerDims.assign(domain.begin(), domain.begin() + outerRank);
+    outerStrides.clear();
+    for (const auto& d : dims) {
+        std::vector<size_t> strides(outerRank, 0);
+        size_t stride = 1;
+        for (int k = static_cast<int>(rank) - 1; k >= 0; k--) {
+            if (k < outerRank && d[k] != 1)
+                strides[k] = stride;
+            stride *= d[k];
+        }
+        outerStrides.push_back(strides);
+    }
+
+    // split the innermost dimension if there are not enough outer iterations to load all the threads
+    size_t outerCount = 1;
+    for (auto d : outerDims)
+        outerCount *= d;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    innerChunk = innerSize;
+    if (outerCount < nthr) {
+        const size_t minChunk = 256;
+        const size_t chunksPerOuter = (nthr + outerCount - 1) / outerCount;
+        size_t chunk = (innerSize + chunksPerOuter - 1) / chunksPerOuter;
+        // keep chunks aligned to the widest vector to avoid scalar tails in the middle of the row
+        chunk = (chunk + 15) / 16 * 16;
+        innerChunk = std::min(innerSize, std::max(chunk, minChunk));
+    }
+
+    return true;
+}
+
+void MKLDNNSnippetNode::generate() {
+    auto generator = std::make_shared<CPUGenerator>(getHostIsa());
+
+    snippet = snippetRef->make_canonical_from_this();
+    snippet->set_generator(generator);
+
+    std::vector<SizeVector> inputDims, outputDims;
+    for (const auto& dims : inDims)
+        inputDims.push_back(dims.ToSizeVector());
+    for (const auto& dims : outDims)
+        outputDims.push_back(dims.ToSizeVector());
+
+    auto schedule = snippet->generate(getPlanarShapes(outputDims), getPlanarShapes(inputDims));
+    kernel = reinterpret_cast<kernel_t>(const_cast<uint8_t*>(schedule.ptr));
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_ERROR << "Input memory didn't allocate.";
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto& dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_ERROR << "Destination memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "Preferable primitive descriptor is not set.";
+
+    if (kernel == nullptr)
+        generate();
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t numInputs = inDims.size();
+    const size_t numArgs = numInputs + outDims.size();
+    std::vector<const uint8_t*> ptrs(numArgs);
+    for (size_t i = 0; i < numInputs; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgesAtPort(i)[0]->getMemory().GetPtr());
+    for (size_t i = numInputs; i < numArgs; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i - numInputs)[0]->getMemory().GetPtr());
+
+    size_t outerCount = 1;
+    for (auto d : outerDims)
+        outerCount *= d;
+    const size_t innerChunks = (innerSize + innerChunk - 1) / innerChunk;
+
+    parallel_for2d(outerCount, innerChunks, [&](size_t outer, size_t chunk) {
+        jit_snippets_call_args args;
+        const size_t start = chunk * innerChunk;
+        for (size_t i = 0; i < numArgs; i++) {
+            size_t offset = start * innerStrides[i];
+            size_t idx = outer;
+            for (int k = static_cast<int>(outerDims.size()) - 1; k >= 0; k--) {
+                offset += (idx % outerDims[k]) * outerStrides[i][k];
+                idx /= outerDims[k];
+            }
+            args.ptrs[i] = ptrs[i] + offset * sizeof(float);
+        }
+        args.work_amount = std::min(innerChunk, innerSize - start);
+        kernel(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode represents subgraph of elementwise operations collapsed by snippets tokenization.
+/// The subgraph is compiled to a single JIT kernel which is called over the collapsed innermost dimension.
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    /// Checks that the kernel can be generated for the subgraph on the host ISA. The subgraphs which aren't
+    /// supported are unfolded back to their operations before the graph is created.
+    static bool isSupported(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph);
+
+private:
+    using kernel_t = void (*)(const jit_snippets_call_args*);
+
+    bool prepareSchedule();
+    void generate();
+
+    // original subgraph the kernel is generated from
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippetRef;
+    // canonicalized copy the kernel is generated for
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    kernel_t kernel = nullptr;
+
+    // schedule: the kernel processes innerSize elements, outer dimensions are iterated over by the node
+    size_t innerSize = 0;
+    size_t innerChunk = 0;
+    std::vector<size_t> outerDims;
+    // per input and output: element strides along outer dimensions and innermost dimension (0 if broadcasted)
+    std::vector<std::vector<size_t>> outerStrides;
+    std::vector<size_t> innerStrides;
+};
+
+}  // namespace MKLDNNPlugin
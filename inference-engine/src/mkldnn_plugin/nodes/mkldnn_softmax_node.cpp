@@ -8,34 +8,42 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ngraph/op/softmax.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 MKLDNNSoftMaxNode::MKLDNNSoftMaxNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
-        MKLDNNNode(layer, eng, cache) {}
+        MKLDNNNode(layer, eng, cache) {
+    SoftMaxLayer* smLayer = dynamic_cast<SoftMaxLayer*>(layer.get());
+    if (smLayer == nullptr)
+        IE_THROW() << "Cannot convert softmax layer.";
+    axis = smLayer->axis;
+}
+
+MKLDNNSoftMaxNode::MKLDNNSoftMaxNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(op, eng, cache) {
+    auto softmaxOp = ngraph::as_type_ptr<ngraph::op::v1::Softmax>(op);
+    if (softmaxOp == nullptr)
+        IE_THROW() << "Cannot convert softmax operation " << op->get_friendly_name();
+    axis = static_cast<int>(softmaxOp->get_axis());
+}
 
 void MKLDNNSoftMaxNode::getSupportedDescriptors() {
     if (descs.size())
         return;
 
-    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    InferenceEngine::Precision precision = getOriginalInputPrecisionAtPort(0);
     if (precision != InferenceEngine::Precision::FP32 && precision != InferenceEngine::Precision::BF16)
         precision = InferenceEngine::Precision::FP32;
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
 
-    SoftMaxLayer* smLayer = dynamic_cast<SoftMaxLayer*>(getCnnLayer().get());
-    if (smLayer == nullptr)
-        IE_THROW() << "Cannot convert softmax layer.";
-
     if (getParentEdges().size() != 1)
         IE_THROW() << "Incorrect number of input edges for layer " << getName();
     if (!getChildEdges().size())
         IE_THROW() << "Incorrect number of output edges for layer " << getName();
 
-    axis = smLayer->axis;
-
     if (axis >= getParentEdgeAt(0)->getDims().ndims()) {
         IE_THROW() << "Incorrect axis!";
     }
@@ -128,3 +136,4 @@ void MKLDNNSoftMaxNode::createDescriptor(const std::vector<InferenceEngine::Tens
     descs.push_back(desc);
 }
 REG_MKLDNN_PRIM_FOR(MKLDNNSoftMaxNode, SoftMax);
+REG_MKLDNN_PRIM_FOR_NGRAPH(MKLDNNSoftMaxNode, SoftMax);
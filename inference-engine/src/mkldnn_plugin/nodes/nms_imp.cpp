@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+    constexpr size_t block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+
+    static inline bool all_lanes(vmask_type vmask) {
+        return vmask == static_cast<vmask_type>(0xFFFF);
+    }
+    static inline bool any_lane(vmask_type vmask) {
+        return vmask != 0;
+    }
+#elif defined(HAVE_AVX2) || defined(HAVE_SSE42)
+#if defined(HAVE_AVX2)
+    constexpr size_t block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#else
+    constexpr size_t block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+
+    static inline bool all_lanes(vmask_type vmask) {
+        return _mm_uni_movemask_ps(vmask) == (1 << block_size) - 1;
+    }
+    static inline bool any_lane(vmask_type vmask) {
+        return _mm_uni_movemask_ps(vmask) != 0;
+    }
+#endif
+
+static inline float intersection_over_union(const nms_kept_boxes& kept, size_t k,
+                                            float xmin, float ymin, float xmax, float ymax, float area) {
+    const float width = (std::min)(xmax, kept.xmax[k]) - (std::max)(xmin, kept.xmin[k]);
+    const float height = (std::min)(ymax, kept.ymax[k]) - (std::max)(ymin, kept.ymin[k]);
+    if (width <= 0.f || height <= 0.f)
+        return 0.f;
+    const float intersection = width * height;
+    return intersection / (area + kept.area[k] - intersection);
+}
+
+static bool is_suppressed(const nms_kept_boxes& kept, float xmin, float ymin, float xmax, float ymax, float area,
+                          const nms_conf& conf) {
+    size_t k = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vxmin = _mm_uni_set1_ps(xmin);
+    const vec_type_f vymin = _mm_uni_set1_ps(ymin);
+    const vec_type_f vxmax = _mm_uni_set1_ps(xmax);
+    const vec_type_f vymax = _mm_uni_set1_ps(ymax);
+    const vec_type_f varea = _mm_uni_set1_ps(area);
+    const vec_type_f vthreshold = _mm_uni_set1_ps(conf.iou_threshold);
+    const vec_type_f vzero = _mm_uni_setzero_ps();
+
+    for (; k + block_size <= kept.size; k += block_size) {
+        const vec_type_f vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(vxmax, _mm_uni_loadu_ps(&kept.xmax[k])),
+                                                 _mm_uni_max_ps(vxmin, _mm_uni_loadu_ps(&kept.xmin[k])));
+        const vec_type_f vheight = _mm_uni_sub_ps(_mm_uni_min_ps(vymax, _mm_uni_loadu_ps(&kept.ymax[k])),
+                                                  _mm_uni_max_ps(vymin, _mm_uni_loadu_ps(&kept.ymin[k])));
+        const vec_type_f vintersection = _mm_uni_mul_ps(_mm_uni_max_ps(vwidth, vzero), _mm_uni_max_ps(vheight, vzero));
+        const vec_type_f vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea, _mm_uni_loadu_ps(&kept.area[k])), vintersection);
+        // boxes without a common area have zero IoU regardless of their sizes
+        const vec_type_f viou = _mm_uni_blendv_ps(vzero, _mm_uni_div_ps(vintersection, vunion),
+                                                  _mm_uni_cmpgt_ps(vintersection, vzero));
+        if (conf.suppress_equal) {
+            if (!all_lanes(_mm_uni_cmpgt_ps(vthreshold, viou)))
+                return true;
+        } else {
+            if (any_lane(_mm_uni_cmpgt_ps(viou, vthreshold)))
+                return true;
+        }
+    }
+#endif
+
+    for (; k < kept.size; k++) {
+        const float iou = intersection_over_union(kept, k, xmin, ymin, xmax, ymax, area);
+        if (conf.suppress_equal ? iou >= conf.iou_threshold : iou > conf.iou_threshold)
+            return true;
+    }
+    return false;
+}
+
+size_t nms_select(const float* candidates, size_t count, nms_kept_boxes& kept, int* selected, nms_conf& conf) {
+    size_t i = 0;
+    for (; i < count && kept.size < conf.max_kept; i++) {
+        const float xmin = candidates[i * 4 + 0];
+        const float ymin = candidates[i * 4 + 1];
+        const float xmax = candidates[i * 4 + 2];
+        const float ymax = candidates[i * 4 + 3];
+        const float area = (xmax - xmin) * (ymax - ymin);
+
+        if (is_suppressed(kept, xmin, ymin, xmax, ymax, area, conf))
+            continue;
+
+        const size_t k = kept.size++;
+        kept.xmin[k] = xmin;
+        kept.ymin[k] = ymin;
+        kept.xmax[k] = xmax;
+        kept.ymax[k] = ymax;
+        kept.area[k] = area;
+        selected[k] = static_cast<int>(i);
+    }
+    return i;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
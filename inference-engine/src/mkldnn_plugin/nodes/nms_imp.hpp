@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes kept by the greedy selection, stored by coordinates to test a candidate against a block of them at once
+struct nms_kept_boxes {
+    std::vector<float> xmin;
+    std::vector<float> ymin;
+    std::vector<float> xmax;
+    std::vector<float> ymax;
+    std::vector<float> area;
+    size_t size = 0;
+
+    void reset(size_t capacity) {
+        xmin.resize(capacity);
+        ymin.resize(capacity);
+        xmax.resize(capacity);
+        ymax.resize(capacity);
+        area.resize(capacity);
+        size = 0;
+    }
+};
+
+struct nms_conf {
+    float iou_threshold;
+    // candidate is suppressed by IoU equal to the threshold as well (NonMaxSuppression), or by greater IoU only
+    bool suppress_equal;
+    size_t max_kept;
+};
+
+namespace XARCH {
+
+/**
+ * Greedy selection over the candidates sorted by descending score: the candidate is kept if it isn't suppressed
+ * by any of the kept boxes. Candidates are given by normalized corners {xmin, ymin, xmax, ymax}, kept candidates are
+ * appended to kept and their positions to selected. Stops when max_kept boxes are kept.
+ *
+ * @return number of the processed candidates
+ */
+size_t nms_select(const float* candidates, size_t count, nms_kept_boxes& kept, int* selected, nms_conf& conf);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
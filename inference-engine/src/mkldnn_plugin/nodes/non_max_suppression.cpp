@@ -12,6 +12,7 @@
 #include <utility>
 #include <queue>
 #include "ie_parallel.hpp"
+#include "nms_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -143,29 +144,29 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    //  corners of the box in the {xmin, ymin, xmax, ymax} order
+    void boxCorners(const float *box, float *corners) {
         if (boxEncodingType == boxEncoding::CENTER) {
             //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+            corners[0] = box[0] - box[2] / 2.f;
+            corners[1] = box[1] - box[3] / 2.f;
+            corners[2] = box[0] + box[2] / 2.f;
+            corners[3] = box[1] + box[3] / 2.f;
         } else {
             //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+            corners[0] = (std::min)(box[1], box[3]);
+            corners[1] = (std::min)(box[0], box[2]);
+            corners[2] = (std::max)(box[1], box[3]);
+            corners[3] = (std::max)(box[0], box[2]);
         }
+    }
+
+    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
+        float cornersI[4], cornersJ[4];
+        boxCorners(boxesI, cornersI);
+        boxCorners(boxesJ, cornersJ);
+        const float xminI = cornersI[0], yminI = cornersI[1], xmaxI = cornersI[2], ymaxI = cornersI[3];
+        const float xminJ = cornersJ[0], yminJ = cornersJ[1], xmaxJ = cornersJ[2], ymaxJ = cornersJ[3];
 
         float areaI = (ymaxI - yminI) * (xmaxI - xminI);
         float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
@@ -257,43 +258,55 @@ public:
 
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
-        int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        // only the top scored candidates are usually tested before max_output_boxes_per_class boxes are selected,
+        // so candidates are ordered by chunks instead of sorting all of them
+        const size_t minSortChunk = 64;
+        auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+        };
+
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
             const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            std::vector<std::pair<float, int>> candidates(num_boxes);
+            size_t candidatesNum = 0;
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                candidates[candidatesNum] = std::make_pair(scoresPtr[box_idx], box_idx);
+                candidatesNum += scoresPtr[box_idx] > score_threshold ? 1 : 0;
             }
+            candidates.resize(candidatesNum);
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+            nms_conf conf = {iou_threshold, true, max_output_boxes_per_class};
+            nms_kept_boxes kept;
+            kept.reset((std::min)(max_output_boxes_per_class, candidatesNum));
+            std::vector<int> selected(kept.xmin.size());
+            std::vector<float> corners;
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+            size_t offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            size_t processed = 0;
+            while (processed < candidatesNum && kept.size < max_output_boxes_per_class) {
+                const size_t chunk = (std::min)(candidatesNum - processed,
+                                                (std::max)(2 * (max_output_boxes_per_class - kept.size), minSortChunk));
+                auto first = candidates.begin() + processed;
+                auto last = first + chunk;
+                if (last != candidates.end())
+                    std::nth_element(first, last, candidates.end(), greater);
+                std::sort(first, last, greater);
+
+                corners.resize(chunk * 4);
+                for (size_t i = 0; i < chunk; i++)
+                    boxCorners(&boxesPtr[candidates[processed + i].second * 4], &corners[i * 4]);
+
+                const size_t keptBefore = kept.size;
+                XARCH::nms_select(corners.data(), chunk, kept, selected.data(), conf);
+                for (size_t k = keptBefore; k < kept.size; k++) {
+                    const auto& box = candidates[processed + selected[k]];
+                    filtBoxes[offset + k] = filteredBoxes(box.first, batch_idx, class_idx, box.second);
                 }
+                processed += chunk;
             }
-            numFiltBox[batch_idx][class_idx] = io_selection_size;
+            numFiltBox[batch_idx][class_idx] = kept.size;
         });
     }
 
@@ -18,7 +18,9 @@ class PerfCount {
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // average in microseconds
+    uint64_t avg() { return avg_ns() / 1000; }
+    uint64_t avg_ns() { return (num == 0) ? 0 : duration / num; }
 
 private:
     void start_itr() {
@@ -28,7 +30,7 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
         num++;
     }
 
@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace {
+
+bool isNumaBindingSupported(int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    return numaNodeId >= 0 && InferenceEngine::getAvailableNUMANodes().size() > 1;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Allocator of the blob memory on a NUMA node. The handle points to the reference to the memory,
+ * which knows how to release it, so the memory of both kinds is freed the same way.
+ */
+class NumaAllocator final : public InferenceEngine::IAllocator {
+public:
+    explicit NumaAllocator(int numaNodeId) : numaNodeId(numaNodeId) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return static_cast<std::shared_ptr<void>*>(handle)->get();
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            auto memory = allocateOnNumaNode(size, numaNodeId);
+            if (!memory)
+                memory = std::shared_ptr<void>(new char[size], std::default_delete<char[]>());
+            return new std::shared_ptr<void>(std::move(memory));
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        delete static_cast<std::shared_ptr<void>*>(handle);
+        return true;
+    }
+
+private:
+    int numaNodeId;
+};
+
+}  // namespace
+
+std::shared_ptr<void> allocateOnNumaNode(size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (size == 0 || !isNumaBindingSupported(numaNodeId))
+        return nullptr;
+
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t mappedSize = (size + pageSize - 1) / pageSize * pageSize;
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+    constexpr int mpolPreferred = 1;  // MPOL_PREFERRED from <numaif.h>
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerMask + 1, 0);  // NOLINT
+    nodeMask[numaNodeId / bitsPerMask] = 1ul << (numaNodeId % bitsPerMask);
+
+    if (0 != syscall(SYS_mbind, ptr, mappedSize, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerMask + 1, 0u)) {
+        munmap(ptr, mappedSize);
+        return nullptr;
+    }
+
+    return std::shared_ptr<void>(ptr, [mappedSize](void* p) { munmap(p, mappedSize); });
+#else
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<InferenceEngine::IAllocator> createNumaAllocator(int numaNodeId) {
+    if (!isNumaBindingSupported(numaNodeId))
+        return nullptr;
+    return std::make_shared<NumaAllocator>(numaNodeId);
+}
+
+void firstTouch(void* ptr, size_t size) {
+    if (ptr == nullptr || size == 0)
+        return;
+
+    auto* data = static_cast<uint8_t*>(ptr);
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(size, nthr, ithr, start, end);
+        if (end > start)
+            std::memset(data + start, 0, end - start);
+    });
+}
+
+}  // namespace MKLDNNPlugin
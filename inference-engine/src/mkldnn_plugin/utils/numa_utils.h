@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Allocates memory from a dedicated anonymous mapping, which is bound to the NUMA node as a whole,
+ * so no other allocation shares its pages. The mapping is zero filled and its pages are placed on
+ * the node when they are touched for the first time. The memory is unmapped with the last reference.
+ *
+ * @param size size of the memory in bytes
+ * @param numaNodeId NUMA node the memory is expected to be accessed from
+ * @return nullptr if the binding isn't supported by the system, there is only one NUMA node
+ * or numaNodeId is negative, so the regular allocation should be used
+ */
+std::shared_ptr<void> allocateOnNumaNode(size_t size, int numaNodeId);
+
+/**
+ * Creates the allocator of blobs whose memory is allocated by allocateOnNumaNode().
+ * If a mapping cannot be bound, the allocator falls back to the regular heap memory.
+ *
+ * @return nullptr if the binding isn't supported, so the default allocator should be used
+ */
+std::shared_ptr<InferenceEngine::IAllocator> createNumaAllocator(int numaNodeId);
+
+/**
+ * Writes zeros to the memory range from the threads of the current parallel context,
+ * so the pages are mapped on the NUMA node of the threads which will process the data.
+ */
+void firstTouch(void* ptr, size_t size);
+
+}  // namespace MKLDNNPlugin
@@ -13,12 +13,16 @@
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -42,26 +46,117 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
     enum InferState {Idle, Busy, Canceled, Stop};
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     InferRequestInternal::Ptr _syncRequest;
 
     friend struct DisableCallbackGuard;
     struct DisableCallbackGuard {
         explicit DisableCallbackGuard(AsyncInferRequestThreadSafeDefault* this_)
-            : _this{this_} {
-                std::lock_guard<std::mutex> lock{_this->_mutex};
-                std::swap(_callback, _this->_callback);
-            }
+            : _this{this_}, _callback{_this->_callback.exchange(nullptr)} {}
         ~DisableCallbackGuard() {
-            std::lock_guard<std::mutex> lock{_this->_mutex};
             _this->_callback = _callback;
         }
         AsyncInferRequestThreadSafeDefault* _this = nullptr;
         IInferRequest::CompletionCallback _callback = nullptr;
     };
 
+    /**
+     * @brief Completion state reused by all runs of the request instead of a promise and a future per run.
+     *        Runs are numbered, so a run started from the callback of the previous one is told apart from it.
+     *        The mutex is taken only to block a waiter or to store an exception.
+     *        Completing tasks hold their own reference, so the state outlives the request destroyed right after
+     *        the last run is completed.
+     */
+    struct Completion {
+        /**
+         * @brief Completes the run and wakes up waiters if there are any
+         * @param[in]  runId      Run number
+         * @param[in]  exception  Exception the run is failed with or nullptr
+         */
+        void Complete(std::uint64_t runId, const std::exception_ptr& exception) {
+            if (nullptr != exception) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _failures[runId % failuresCount] = {runId, exception};
+                Advance(_failed, runId);
+            }
+            Advance(_completed, runId);
+            Release();
+        }
+
+        /**
+         * @brief Finishes the usage of the state by a run or an attempt to start a run
+         */
+        void Release() {
+            _active.fetch_sub(1);
+            if (0 != _waiters.load()) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _condVar.notify_all();
+            }
+        }
+
+        /**
+         * @brief Waits for the predicate to be true. Spins for a while first as short runs often complete before
+         *        a blocked thread would be scheduled again
+         * @param[in]  pred           Predicate checked without a lock
+         * @param[in]  millisTimeout  Timeout in milliseconds, or a negative value to wait infinitely
+         * @return `true` if the predicate is true
+         */
+        template<typename Pred>
+        bool Wait(const Pred& pred, const std::int64_t millisTimeout) {
+            for (int spin = 0; spin < spinCount; ++spin) {
+                if (pred()) return true;
+                std::this_thread::yield();
+            }
+            bool ready = false;
+            _waiters.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                if (millisTimeout < 0) {
+                    _condVar.wait(lock, pred);
+                    ready = true;
+                } else {
+                    ready = _condVar.wait_for(lock, std::chrono::milliseconds{millisTimeout}, pred);
+                }
+            }
+            _waiters.fetch_sub(1);
+            return ready;
+        }
+
+        /**
+         * @brief Rethrows the exception the run is failed with if any
+         * @param[in]  runId  Run number
+         */
+        void RethrowIfFailed(std::uint64_t runId) {
+            // no run is failed since this one was started
+            if (_failed.load() < runId) return;
+            std::exception_ptr exception;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                const auto& failure = _failures[runId % failuresCount];
+                if (failure.first == runId) exception = failure.second;
+            }
+            if (nullptr != exception) std::rethrow_exception(exception);
+        }
+
+        static void Advance(std::atomic<std::uint64_t>& counter, std::uint64_t runId) {
+            auto value = counter.load();
+            while (value < runId && !counter.compare_exchange_weak(value, runId)) {}
+        }
+
+        static constexpr int spinCount = 64;
+        // Exceptions of the last failed runs, so a waiter woken up late doesn't miss the exception of its run
+        static constexpr std::size_t failuresCount = 8;
+
+        std::atomic<std::uint64_t> _started = {0};  //!< Number of the last started run
+        std::atomic<std::uint64_t> _completed = {0};  //!< Number of the last completed run
+        std::atomic<std::uint64_t> _failed = {0};  //!< Number of the last failed run
+        std::atomic<std::size_t> _active = {0};  //!< Number of the runs which are not completed yet
+        std::atomic<std::size_t> _waiters = {0};
+        std::pair<std::uint64_t, std::exception_ptr> _failures[failuresCount];
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+    };
+
     struct ImmediateStreamsExecutor : public InferenceEngine::ITaskExecutor {
         explicit ImmediateStreamsExecutor(const IStreamsExecutor::Ptr& streamsExecutor) : _streamsExecutor{streamsExecutor} {}
         void run(InferenceEngine::Task task) override {_streamsExecutor->Execute(std::move(task));}
@@ -71,52 +166,42 @@ class AsyncInferRequestThreadSafeDefault : public IAsyncInferRequestInternal {
     template<typename F>
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
+        // The run is counted as active before the state is changed, so StopAndWait() can't miss it
+        _completion->_active.fetch_add(1);
         InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            switch (_state) {
+        if (!_state.compare_exchange_strong(state, InferState::Busy)) {
+            _completion->Release();
+            switch (state) {
             case InferState::Busy :
                 IE_THROW(RequestBusy);
             case InferState::Canceled :
                 IE_THROW(InferCancelled);
-            case InferState::Idle : {
-                _futures.erase(std::remove_if(std::begin(_futures), std::end(_futures),
-                                                [](const std::shared_future<void>& future) {
-                                                    if (future.valid()) {
-                                                        return (std::future_status::ready ==
-                                                                future.wait_for(std::chrono::milliseconds {0}));
-                                                    } else {
-                                                        return true;
-                                                    }
-                                                }),
-                                _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
-            } break;
-            case InferState::Stop : break;
+            default: return;
             }
-            _state = InferState::Busy;
         }
-        if (state != InferState::Stop) {
-            try {
-                f();
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
-                throw;
-            }
+        _runId = _completion->_started.load() + 1;
+        _completion->_started = _runId;
+        try {
+            f();
+        } catch (...) {
+            SetIdle();
+            _completion->Complete(_runId, std::current_exception());
+            throw;
         }
     }
 
+    void SetIdle() {
+        InferState state = _state.load();
+        while ((InferState::Busy == state || InferState::Canceled == state) &&
+               !_state.compare_exchange_weak(state, InferState::Idle)) {}
+    }
+
 protected:
     /**
      * @brief Throws exception if inference request is busy or canceled
      */
     void CheckState() const {
-        std::lock_guard<std::mutex> lock {_mutex};
-        switch (_state) {
+        switch (_state.load()) {
         case InferState::Busy :
             IE_THROW(RequestBusy);
         case InferState::Canceled :
@@ -173,33 +258,27 @@ public:
                 << " Timeout can't be less "
                 << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock {_mutex};
-            return _futures.empty() ? std::shared_future<void> {} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just wait for the last started run
+        auto completion = _completion;
+        auto runId = completion->_started.load();
+        // A busy request with the last started run completed is just started, but the run number isn't taken yet
+        const auto state = _state.load();
+        if ((InferState::Busy == state || InferState::Canceled == state) && completion->_completed.load() >= runId) {
+            ++runId;
+        }
+        if (0 == runId) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
-        switch (millis_timeout) {
-        case IInferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case IInferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds {0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds {millis_timeout});
-        } break;
+        auto isCompleted = [&] {return completion->_completed.load() >= runId;};
+        bool ready = isCompleted();
+        if (!ready && IInferRequest::WaitMode::STATUS_ONLY != millis_timeout) {
+            ready = completion->Wait(isCompleted,
+                IInferRequest::WaitMode::RESULT_READY == millis_timeout ? -1 : millis_timeout);
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
+        if (ready) {
+            completion->RethrowIfFailed(runId);
             return StatusCode::OK;
         } else {
             return StatusCode::RESULT_NOT_READY;
@@ -275,17 +354,14 @@ public:
     }
 
     void ThrowIfCanceled() const {
-        std::lock_guard<std::mutex> lock{_mutex};
-        if (_state == InferState::Canceled) {
+        if (_state.load() == InferState::Canceled) {
             IE_THROW(InferCancelled);
         }
     }
 
     void Cancel() override {
-        std::lock_guard<std::mutex> lock{_mutex};
-        if (_state == InferState::Busy) {
-            _state = InferState::Canceled;
-        }
+        InferState state = InferState::Busy;
+        _state.compare_exchange_strong(state, InferState::Canceled);
     }
 
 protected:
@@ -299,9 +375,8 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. The pipeline end and the callback executor are kept by the request
+     * until the run is completed, so stage tasks don't copy them
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -310,7 +385,9 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _itEndStage = itEndStage;
+        _lastStageExecutor = std::move(callbackExecutor);
+        firstStageExecutor->run(MakeNextStageTask(itBeginStage));
     }
 
     /**
@@ -320,22 +397,9 @@ protected:
      */
     void StopAndWait() {
         _callback = nullptr;
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
-        if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
-            }
+        if (_state.exchange(InferState::Stop) != InferState::Stop) {
+            auto completion = _completion;
+            completion->Wait([&] {return 0 == completion->_active.load();}, -1);
         }
     }
 
@@ -372,33 +436,31 @@ protected:
 private:
     /**
      * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
+     * The task captures only the request and the stage, so it is stored by the Task without a heap allocation.
      * On last stage or if the exception is raised from `_pipeline` task
      * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * callback, if it is presented, and completes the run, so the `Wait` calls waiting for it are returned
      * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
+    Task MakeNextStageTask(const Pipeline::iterator itStage) {
+        return [this, itStage] {
             StatusCode requestStatus = StatusCode::OK;
             std::exception_ptr localCurrentException = nullptr;
             auto& thisStage = *itStage;
             auto itNextStage = itStage + 1;
+            // The request may be completed and restarted once the next stage is scheduled
+            const bool isLastStage = _itEndStage == itNextStage;
 
             try {
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
                 stageTask();
-               if (itEndStage != itNextStage) {
+                if (!isLastStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run(MakeNextStageTask(itNextStage));
                 }
             } catch (InferenceEngine::Exception& ie_ex) {
                 requestStatus = ExceptionToStatus(ie_ex);
@@ -408,46 +470,51 @@ private:
                 localCurrentException = std::current_exception();
             }
 
-            if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
-                auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
-                    auto promise = std::move(_promise);
-                    IInferRequest::CompletionCallback callback = nullptr;
-                    {
-                        std::lock_guard<std::mutex> lock{_mutex};
-                        _state = InferState::Idle;
-                        callback = _callback;
-                    }
-                    if (nullptr != callback) {
-                        InferenceEngine::CurrentException() = localCurrentException;
-                        try {
-                            callback(_publicInterface, requestStatus);
-                        } catch (...) {
-                            localCurrentException = std::current_exception();
-                        }
-                        InferenceEngine::CurrentException() = nullptr;
-                    }
-                    if (nullptr == localCurrentException) {
-                        promise.set_value();
-                    } else {
-                        promise.set_exception(localCurrentException);
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
+            if (isLastStage || (nullptr != localCurrentException)) {
+                _requestStatus = requestStatus;
+                _requestException = std::move(localCurrentException);
+                auto lastStageExecutor = _lastStageExecutor;
+                if (nullptr == lastStageExecutor) {
+                    RunLastStage();
                 } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+                    lastStageExecutor->run([this] {RunLastStage();});
                 }
             }
-        }, std::move(callbackExecutor));
+        };
+    }
+
+    /**
+     * @brief Sets the request idle, calls the callback and completes the run. The callback may start the request
+     * again, so the run state is moved to locals first
+     */
+    void RunLastStage() {
+        auto completion = _completion;
+        const auto runId = _runId;
+        const auto requestStatus = _requestStatus;
+        auto localCurrentException = std::move(_requestException);
+        SetIdle();
+        auto callback = _callback.load();
+        if (nullptr != callback) {
+            InferenceEngine::CurrentException() = localCurrentException;
+            try {
+                callback(_publicInterface, requestStatus);
+            } catch (...) {
+                localCurrentException = std::current_exception();
+            }
+            InferenceEngine::CurrentException() = nullptr;
+        }
+        completion->Complete(runId, localCurrentException);
     }
 
     void* _userData = nullptr;
-    IInferRequest::CompletionCallback _callback = nullptr;
+    std::atomic<IInferRequest::CompletionCallback> _callback = {nullptr};
     IInferRequest::Ptr _publicInterface;
-    std::promise<void> _promise;
-    mutable std::mutex _mutex;
-    Futures _futures;
-    InferState _state = InferState::Idle;
+    std::shared_ptr<Completion> _completion = std::make_shared<Completion>();
+    std::uint64_t _runId = 0;
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _lastStageExecutor;
+    StatusCode _requestStatus = StatusCode::OK;
+    std::exception_ptr _requestException;
+    std::atomic<InferState> _state = {InferState::Idle};
 };
 }  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -20,7 +21,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Each stream thread pulls tasks from its own queue and steals tasks from the queues of other
+ *        streams, preferring the streams of the same NUMA node, when its queue is empty.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -29,6 +31,16 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Statistics of tasks submitted by `run()` since the executor creation
+     */
+    struct Statistics {
+        std::size_t _tasks                = 0;  //!< Number of submitted tasks
+        std::size_t _stolenTasks          = 0;  //!< Number of tasks executed by a stream other than the one they were queued to
+        double      _taskRate             = 0;  //!< Average number of tasks submitted per second
+        double      _averageQueueWaitTime = 0;  //!< Average time in microseconds a task waits in a queue before execution
+    };
+
     /**
     * @brief Constructor
     * @param config Stream executor parameters
@@ -48,6 +60,26 @@ public:
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Runs the task on one of the streams of the NUMA node. The task is executed by a stream of another node
+     *        only if it's stolen by an idle stream or the node has no streams.
+     * @param task A task to start
+     * @param numaNodeId `ID` of the NUMA node
+     */
+    void RunOnNumaNode(Task task, int numaNodeId);
+
+    /**
+     * @brief Returns NUMA nodes the streams are distributed between
+     * @return `ID`s of NUMA nodes
+     */
+    std::vector<int> GetUsedNumaNodes() const;
+
+    /**
+     * @brief Returns task queue statistics
+     * @return Statistics collected since the executor creation
+     */
+    Statistics GetStatistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -83,6 +83,7 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _spinCount               = 0;  //!< Number of times an idle stream thread polls for new tasks before it is parked
 
         /**
          * @brief      A constructor with arguments
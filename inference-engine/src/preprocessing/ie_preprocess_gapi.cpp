@@ -683,6 +683,15 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+
+int greatest_common_divisor(int a, int b) {
+    while (b != 0) {
+        const int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
 }  // anonymous namespace
 
 PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
@@ -834,9 +843,20 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     // that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
+    // Batch items are processed in parallel by `groups` groups of
+    // slices, slices of a group split rows of the group's items.
+    // With the greatest common divisor every slice still gets the
+    // same amount of work, but processes bigger ROIs in fewer calls
+    // (a whole image per call if the batch is a multiple of slices).
+    //
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
+        const int groups = greatest_common_divisor(batch_size, total_slices);
+        const int group_n = slice_n % groups;
+        const int group_slices = total_slices / groups;
+        const int group_slice_n = slice_n / groups;
+
         auto& compiled = _lastComp[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
@@ -848,22 +868,26 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             const auto& input_plane_mats = batched_input_plane_mats[0];
             const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+            auto lines_per_thread = output_plane_mats[0].rows / group_slices;
+            const auto remainder = output_plane_mats[0].rows % group_slices;
 
             // remainder shows how many threads must calculate 1 additional row. now these additions
             // must also be addressed in rect's Y coordinate:
             int roi_y = 0;
-            if (slice_n < remainder) {
+            if (group_slice_n < remainder) {
                 lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+                roi_y = group_slice_n * lines_per_thread;  // all previous rois have lines+1 rows
             } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+                // remainder rois have lines+1 rows, the rest prior to group_slice_n have lines rows
                 roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+                    remainder * (lines_per_thread + 1) + (group_slice_n - remainder) * lines_per_thread;
             }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+            if (lines_per_thread <= 0) {
+                // no job for current thread, drop the object compiled for the previous ROI
+                compiled = cv::GCompiled();
+                return;
+            }
 
             auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
@@ -880,7 +904,9 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        if (!compiled) return;  // no job for current thread
+
+        for (int i = group_n; i < batch_size; i += groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -947,7 +973,13 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    Update update = needUpdate(thisCall);
+    // the slices are regrouped between the batch items, so the ones which had no rows to process
+    // and aren't compiled may get some
+    if (batch_size != _lastBatchSize) {
+        update = Update::REBUILD;
+        _lastBatchSize = batch_size;
+    }
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
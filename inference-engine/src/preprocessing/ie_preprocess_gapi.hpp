@@ -27,6 +27,7 @@ class PreprocEngine {
 
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
+    int _lastBatchSize = 0;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
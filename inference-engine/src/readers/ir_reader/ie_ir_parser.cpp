@@ -89,6 +89,9 @@ bool stringToType(const std::string& valStr, T& value) {
     return !ss.fail();
 }
 
+// Buffers of the Const layers by their offset and size in the weights
+using SharedConstants = std::map<std::pair<size_t, size_t>, std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
 class XmlDeserializer : public ngraph::AttributeVisitor {
 public:
     /// TODO: move whole class to src file
@@ -96,8 +99,9 @@ public:
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
-        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
-        : node(node), weights(weights), opsets(opsets), variables(variables) {}
+        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables,
+        SharedConstants& constants)
+        : node(node), weights(weights), opsets(opsets), variables(variables), constants(constants) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -215,6 +219,7 @@ private:
     const Blob::CPtr& weights;
     const std::unordered_map<std::string, ngraph::OpSet>& opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
+    SharedConstants& constants;
 
     ///
     /// store information about parameters/results order during function creation
@@ -516,10 +521,14 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
                 IE_THROW() << "Attribute and shape size are inconsistent for " << type
                                    << " op!";
 
-            char* data = weights->cbuffer().as<char*>() + offset;
+            // Constants deduplicated on serialization refer to the same data, so they share one buffer
+            auto& buffer = constants[{offset, size}];
+            if (!buffer) {
+                char* data = weights->cbuffer().as<char*>() + offset;
 
-            using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
-            auto buffer = std::make_shared<SharedBuffer>(data, size, weights);
+                using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+                buffer = std::make_shared<SharedBuffer>(data, size, weights);
+            }
             a->set(buffer);
         }
     } else {
@@ -816,7 +825,7 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
             constant->alloc_buffer_on_visit_attributes(false);
         }
         ngraphNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, opsets, variables);
+        XmlDeserializer visitor(node, weights, opsets, variables, constants);
         if (ngraphNode->visit_attributes(visitor)) {
             ngraphNode->constructor_validate_and_infer_types();
         }
@@ -882,7 +891,8 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 std::shared_ptr<ICNNNetwork> V10Parser::parse(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
     std::shared_ptr<ngraph::Function> function;
-    XmlDeserializer visitor(root, weights, opsets, variables);
+    SharedConstants constants;
+    XmlDeserializer visitor(root, weights, opsets, variables, constants);
     visitor.on_attribute("net", function);
 
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "ConstructCNNNetwork");
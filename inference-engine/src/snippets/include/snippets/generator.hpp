@@ -32,6 +32,11 @@ public:
     Emitter(const std::shared_ptr<ngraph::Node>& n) {
     }
 
+    /**
+     * @brief Default destructor
+     */
+    virtual ~Emitter() = default;
+
     /**
      * @brief called by generator to generate code to produce target code for a specific operation
      * @param in vector of vector argument registers
@@ -10,6 +10,7 @@
 #include <transformations_visibility.hpp>
 
 #include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pass/parallel_executor.hpp>
 
 
 namespace ngraph {
@@ -20,8 +21,20 @@ class TRANSFORMATIONS_API CommonOptimizations;
 }  // namespace pass
 }  // namespace ngraph
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief CommonOptimizations transformation runs the common optimizations of the plugins
+ *
+ *  If the executor is set, constant folding evaluates independent nodes and the fusions match
+ *  their patterns with it in parallel, otherwise all the passes are sequential.
+ */
 class ngraph::pass::CommonOptimizations: public ngraph::pass::FunctionPass {
 public:
     NGRAPH_RTTI_DECLARATION;
+    explicit CommonOptimizations(const ngraph::pass::parallel_executor& executor = nullptr)
+        : m_executor(executor) {}
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    ngraph::pass::parallel_executor m_executor;
 };
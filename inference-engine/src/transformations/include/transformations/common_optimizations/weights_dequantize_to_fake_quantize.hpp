@@ -25,9 +25,12 @@ class TRANSFORMATIONS_API WeightsDequantizeToFakeQuantize;
  *  with
  *      Constant (i8) -> Convert (to fp) -> FakeQuantize ->
  *  deducing levels and FakeQuantize limits according to actual values in the weights Constant
+ *
+ *  If keep_weights_compressed is set, u8 weights are converted as well and the Convert isn't constant folded,
+ *  so the plugin gets the weights in their original precision along with the dequantization parameters.
  */
 class ngraph::pass::WeightsDequantizeToFakeQuantize: public ngraph::pass::MatcherPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    WeightsDequantizeToFakeQuantize();
+    explicit WeightsDequantizeToFakeQuantize(bool keep_weights_compressed = false);
 };
@@ -6,16 +6,18 @@
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/pattern/op/or.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
 #include <transformations/utils/utils.hpp>
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "itt.hpp"
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::WeightsDequantizeToFakeQuantize, "WeightsDequantizeToFakeQuantize", 0);
 
-ngraph::pass::WeightsDequantizeToFakeQuantize::WeightsDequantizeToFakeQuantize() {
+ngraph::pass::WeightsDequantizeToFakeQuantize::WeightsDequantizeToFakeQuantize(bool keep_weights_compressed) {
     MATCHER_SCOPE(WeightsDequantizeToFakeQuantize);
 
-    const auto weights = ngraph::pattern::wrap_type<ngraph::opset6::Constant>(pattern::type_matches(element::i8));
+    const auto weights = ngraph::pattern::wrap_type<ngraph::opset6::Constant>(keep_weights_compressed ?
+        pattern::type_matches_any({element::i8, element::u8}) : pattern::type_matches(element::i8));
     const auto convert = ngraph::pattern::wrap_type<ngraph::opset6::Convert>({weights});
     const auto sub_c = ngraph::pattern::wrap_type<ngraph::opset6::Constant>();
     const auto sub = ngraph::pattern::wrap_type<ngraph::opset6::Subtract>({convert, sub_c});
@@ -33,14 +35,18 @@ ngraph::pass::WeightsDequantizeToFakeQuantize::WeightsDequantizeToFakeQuantize()
         const auto &convert_node = pattern_map.at(convert);
         const auto &multiply_node = pattern_map.at(mul);
         const auto &scale_node = pattern_map.at(mul_c);
-        if (!weights_node || !convert_node || !multiply_node || !scale_node) {
+        if (!weights_node || !convert_node || !multiply_node || !scale_node || transformation_callback(multiply_node)) {
             return false;
         }
 
-        const auto *data = weights_node->get_data_ptr<int8_t>();
-        const int8_t weights_minimum = *std::min_element(data, data + shape_size(weights_node->get_shape()));
-        int64_t levels = (weights_minimum == static_cast<int8_t>(-128)) ? 256 : 255;
-        int64_t in_low = -(levels / 2), in_high = levels + in_low - 1;
+        int64_t levels = 256, in_low = 0;
+        if (weights_node->get_element_type() == element::i8) {
+            const auto *data = weights_node->get_data_ptr<int8_t>();
+            const int8_t weights_minimum = *std::min_element(data, data + shape_size(weights_node->get_shape()));
+            levels = (weights_minimum == static_cast<int8_t>(-128)) ? 256 : 255;
+            in_low = -(levels / 2);
+        }
+        int64_t in_high = levels + in_low - 1;
 
         const auto &input_low = opset6::Constant::create(convert_node->get_element_type(), {}, {in_low});
         const auto &input_high = opset6::Constant::create(convert_node->get_element_type(), {}, {in_high});
@@ -62,7 +68,9 @@ ngraph::pass::WeightsDequantizeToFakeQuantize::WeightsDequantizeToFakeQuantize()
         ngraph::copy_runtime_info(nodes_to_copy_RT_info_from, fq);
         multiply_node->output(0).replace(fq->output(0));
 
-        if (convert_node->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
+        if (keep_weights_compressed)
+            convert_node->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        else if (convert_node->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
             convert_node->get_rt_info().erase("DISABLED_CONSTANT_FOLDING");
         return true;
     };
@@ -6,6 +6,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +40,65 @@ struct Edge {
     int to_port = 0;
 };
 
+// Writes constants data to the bin file. Constants with the same content
+// (e.g. weights repeated across layers or bodies of TensorIterator) are
+// written once and refer to the same offset.
+class ConstantWriter {
+public:
+    using FilePosition = int64_t;
+    using HashValue = size_t;
+
+    explicit ConstantWriter(std::ostream& bin_data)
+        : m_binary_output(bin_data)
+        , m_blob_offset(bin_data.tellp()) {
+    }
+
+    FilePosition write(const char* ptr, size_t size) {
+        const HashValue hash = hash_data(ptr, size);
+        auto found = m_hash_to_entries.find(hash);
+        if (found != m_hash_to_entries.end()) {
+            for (const auto& entry : found->second) {
+                // constants data is kept alive by the serialized Function
+                if (entry.size == size &&
+                    (entry.ptr == ptr || std::memcmp(entry.ptr, ptr, size) == 0)) {
+                    return entry.offset;
+                }
+            }
+        }
+
+        const FilePosition offset = m_blob_offset;
+        m_binary_output.write(ptr, size);
+        m_blob_offset += size;
+        m_hash_to_entries[hash].push_back({ptr, size, offset});
+        return offset;
+    }
+
+private:
+    struct Entry {
+        const char* ptr;
+        size_t size;
+        FilePosition offset;
+    };
+
+    static HashValue hash_data(const char* ptr, size_t size) {
+        HashValue seed = size;
+        const size_t words = size / sizeof(HashValue);
+        for (size_t i = 0; i < words; ++i) {
+            HashValue word;
+            std::memcpy(&word, ptr + i * sizeof(HashValue), sizeof(HashValue));
+            seed ^= word + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        for (size_t i = words * sizeof(HashValue); i < size; ++i) {
+            seed ^= static_cast<HashValue>(ptr[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+
+    std::ostream& m_binary_output;
+    FilePosition m_blob_offset;
+    std::unordered_map<HashValue, std::vector<Entry>> m_hash_to_entries;
+};
+
 // Here operation type names are translated from ngraph convention to IR
 // convention. Most of them are the same, but there are exceptions, e.g
 // Constant (ngraph name) and Const (IR name). If there will be more
@@ -58,7 +118,7 @@ std::string translate_type_name(const std::string& name) {
 }
 
 void ngfunction_2_irv10(pugi::xml_node& node,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_write_handler,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets);
 
@@ -115,7 +175,7 @@ private:
 
 class XmlSerializer : public ngraph::AttributeVisitor {
     pugi::xml_node& m_xml_node;
-    std::ostream& m_bin_data;
+    ConstantWriter& m_constant_write_handler;
     std::string& m_node_type_name;
     const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
 
@@ -223,11 +283,11 @@ class XmlSerializer : public ngraph::AttributeVisitor {
 
 public:
     XmlSerializer(pugi::xml_node& data,
-                  std::ostream& bin_data,
+                  ConstantWriter& constant_write_handler,
                   std::string& node_type_name,
                   const std::map<std::string, ngraph::OpSet>& custom_opsets)
         : m_xml_node(data)
-        , m_bin_data(bin_data)
+        , m_constant_write_handler(constant_write_handler)
         , m_node_type_name(node_type_name)
         , m_custom_opsets(custom_opsets) {
     }
@@ -256,13 +316,11 @@ public:
         } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
             if (name == "value" &&  translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                const int64_t offset = m_bin_data.tellp();
+                auto data = static_cast<const char*>(a->get()->get_ptr());
+                const int64_t offset = m_constant_write_handler.write(data, size);
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
-
-                auto data = static_cast<const char*>(a->get()->get_ptr());
-                m_bin_data.write(data, size);
             }
         }
     }
@@ -322,11 +380,11 @@ public:
             // to layer above (m_xml_node.parent()) as in ngfunction_2_irv10() layer (m_xml_node) with empty attributes
             // is removed.
             pugi::xml_node xml_body = m_xml_node.parent().append_child(name.c_str());
-            ngfunction_2_irv10(xml_body, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(xml_body, m_constant_write_handler, *adapter.get(), m_custom_opsets);
             xml_body.remove_attribute("name");
             xml_body.remove_attribute("version");
         } else if (name == "net") {
-            ngfunction_2_irv10(m_xml_node, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(m_xml_node, m_constant_write_handler, *adapter.get(), m_custom_opsets);
         } else {
             NGRAPH_CHECK(false, "Unsupported Function name.");
         }
@@ -585,7 +643,7 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
 }
 
 void ngfunction_2_irv10(pugi::xml_node& netXml,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_write_handler,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
@@ -623,7 +681,7 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         if (exec_graph) {
             visit_exec_graph_node(data, node_type_name, node);
         } else {
-            XmlSerializer visitor(data, bin_file, node_type_name, custom_opsets);
+            XmlSerializer visitor(data, constant_write_handler, node_type_name, custom_opsets);
             NGRAPH_CHECK(node->visit_attributes(visitor),
                          "Visitor API is not supported in ", node);
             rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
@@ -734,7 +792,8 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
                 std::string name = "net";
                 pugi::xml_document xml_doc;
                 pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-                XmlSerializer visitor(net_node, bin_file, name, m_custom_opsets);
+                ConstantWriter constant_write_handler(bin_file);
+                XmlSerializer visitor(net_node, constant_write_handler, name, m_custom_opsets);
                 visitor.on_attribute(name, f);
 
                 xml_doc.save(xml_file);
@@ -0,0 +1,69 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <set>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ie_core.hpp"
+#include "ngraph/ngraph.hpp"
+#include <ngraph/opsets/opset6.hpp>
+
+class ConstantsDeduplicationTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+};
+
+TEST_F(ConstantsDeduplicationTest, IdenticalConstantsAreSerializedOnce) {
+    InferenceEngine::Core ie;
+
+    const ngraph::Shape shape{1, 3, 4, 4};
+    const std::vector<float> values(ngraph::shape_size(shape), 0.5f);
+    std::shared_ptr<ngraph::Function> function;
+    {
+        auto parameter = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, shape);
+        auto add_const = ngraph::opset6::Constant::create(ngraph::element::f32, shape, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(parameter, add_const);
+        auto mul_const = ngraph::opset6::Constant::create(ngraph::element::f32, shape, values);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, mul_const);
+        auto sub_const = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.f});
+        auto sub = std::make_shared<ngraph::opset6::Subtract>(mul, sub_const);
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{parameter});
+    }
+
+    InferenceEngine::CNNNetwork expected(function);
+    expected.serialize(m_out_xml_path, m_out_bin_path);
+
+    std::ifstream bin_file(m_out_bin_path, std::ios::binary | std::ios::ate);
+    ASSERT_EQ((values.size() + 1) * sizeof(float), static_cast<size_t>(bin_file.tellg()));
+
+    auto result = ie.ReadNetwork(m_out_xml_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) =
+        compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+
+    // the identical constants share the data after reading
+    size_t constants_count = 0;
+    std::set<const void*> constants_data;
+    for (const auto& op : result.getFunction()->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            constants_count++;
+            constants_data.insert(constant->get_data_ptr());
+        }
+    }
+    ASSERT_EQ(3, constants_count);
+    ASSERT_EQ(2, constants_data.size());
+}
@@ -4,11 +4,15 @@
 
 #include <tuple>
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
 #include <string>
 #include <vector>
 #include <gtest/gtest.h>
 
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <ngraph/opsets/opset1.hpp>
 
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -112,6 +116,47 @@ TEST_P(NetReaderTest, ReadNetworkTwiceSeparately) {
     IE_SUPPRESS_DEPRECATED_END
 }
 
+TEST_P(NetReaderTest, ReadMappedWeightsSameAsWeightsFromMemory) {
+    InferenceEngine::Core ie;
+
+    // weights are mapped to memory when the network is read from files
+    InferenceEngine::CNNNetwork mappedNetwork;
+    read(_modelPath, _weightsPath, ie, mappedNetwork);
+
+    // and are copied to a regular blob when the network is read from memory
+    std::ifstream modelStream(_modelPath, std::ios::binary);
+    const std::string model((std::istreambuf_iterator<char>(modelStream)), std::istreambuf_iterator<char>());
+    std::ifstream weightsStream(_weightsPath, std::ios::binary | std::ios::ate);
+    const size_t weightsSize = weightsStream.tellg();
+    weightsStream.seekg(0, std::ios::beg);
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+            {InferenceEngine::Precision::U8, {weightsSize}, InferenceEngine::C});
+    weights->allocate();
+    weightsStream.read(weights->buffer(), weightsSize);
+    auto network = ie.ReadNetwork(model, weights);
+
+    auto getConstants = [](const InferenceEngine::CNNNetwork& net) {
+        std::map<std::string, std::shared_ptr<ngraph::opset1::Constant>> constants;
+        for (const auto& op : net.getFunction()->get_ops()) {
+            if (auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(op))
+                constants[constant->get_friendly_name()] = constant;
+        }
+        return constants;
+    };
+    const auto mappedConstants = getConstants(mappedNetwork);
+    const auto constants = getConstants(network);
+    ASSERT_FALSE(constants.empty());
+    ASSERT_EQ(mappedConstants.size(), constants.size());
+    for (const auto& item : constants) {
+        const auto mapped = mappedConstants.find(item.first);
+        ASSERT_NE(mapped, mappedConstants.end()) << item.first;
+        ASSERT_EQ(mapped->second->get_element_type(), item.second->get_element_type()) << item.first;
+        ASSERT_EQ(mapped->second->get_shape(), item.second->get_shape()) << item.first;
+        const auto byteSize = ngraph::shape_size(item.second->get_shape()) * item.second->get_element_type().size();
+        ASSERT_EQ(0, std::memcmp(mapped->second->get_data_ptr(), item.second->get_data_ptr(), byteSize)) << item.first;
+    }
+}
+
 #ifdef ENABLE_UNICODE_PATH_SUPPORT
 
 TEST_P(NetReaderTest, ReadCorrectModelWithWeightsUnicodePath) {
@@ -151,10 +196,7 @@ TEST_P(NetReaderTest, ReadCorrectModelWithWeightsUnicodePath) {
 
 #endif
 
-TEST(NetReaderTest, IRSupportModelDetection) {
-    InferenceEngine::Core ie;
-
-    static char const *model = R"V0G0N(<net name="Network" version="10" some_attribute="Test Attribute">
+static char const *modelWithoutWeights = R"V0G0N(<net name="Network" version="10" some_attribute="Test Attribute">
     <layers>
         <layer name="in1" type="Parameter" id="0" version="opset1">
             <data element_type="f32" shape="1,3,22,22"/>
@@ -203,6 +245,9 @@ TEST(NetReaderTest, IRSupportModelDetection) {
 </net>
 )V0G0N";
 
+TEST(NetReaderTest, IRSupportModelDetection) {
+    InferenceEngine::Core ie;
+
     // For supported model detection the IRReader uses first 512 bytes from model.
     // These headers shifts the trim place.
 
@@ -221,8 +266,42 @@ TEST(NetReaderTest, IRSupportModelDetection) {
     InferenceEngine::Blob::CPtr weights;
 
     for (auto header : headers) {
-        ASSERT_NO_THROW(ie.ReadNetwork(header + model, weights));
+        ASSERT_NO_THROW(ie.ReadNetwork(header + modelWithoutWeights, weights));
+    }
+}
+
+TEST(NetReaderTest, ReadModelWithEmptyWeightsFile) {
+    const std::string modelPath = "NetReader_empty_weights_test.xml";
+    const std::string weightsPath = "NetReader_empty_weights_test.bin";
+    std::ofstream modelFile(modelPath);
+    modelFile << modelWithoutWeights;
+    modelFile.close();
+    std::ofstream weightsFile(weightsPath, std::ios::binary);
+    weightsFile.close();
+
+    // an empty file can't be mapped, so the regular reading is used
+    InferenceEngine::Core ie;
+    EXPECT_NO_THROW(ie.ReadNetwork(modelPath, weightsPath));
+
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+}
+
+TEST(NetReaderTest, ReadModelWithMissingWeightsFile) {
+    const std::string modelPath = "NetReader_missing_weights_test.xml";
+    std::ofstream modelFile(modelPath);
+    modelFile << modelWithoutWeights;
+    modelFile.close();
+
+    // the mapping error is not propagated, the regular reading reports that the file can't be opened
+    InferenceEngine::Core ie;
+    try {
+        ie.ReadNetwork(modelPath, "NetReader_missing_weights_test.bin");
+        ADD_FAILURE() << "The network is read without the weights file";
+    } catch (const InferenceEngine::Exception& ex) {
+        EXPECT_NE(std::string(ex.what()).find("cannot be opened"), std::string::npos) << ex.what();
     }
+
+    CommonTestUtils::removeFile(modelPath);
 }
 
 std::string getTestCaseName(testing::TestParamInfo<NetReaderTestParams> testParams) {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -193,6 +194,13 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._spinCount = 1000;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -211,3 +219,35 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+TEST(CPUStreamsExecutorTests, statisticsCountSubmittedTasks) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    std::vector<Future> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        futures.emplace_back(async(taskExecutor, [] {}));
+    }
+    for (auto& f : futures) {
+        f.wait();
+    }
+    auto statistics = taskExecutor->GetStatistics();
+    ASSERT_EQ(static_cast<std::size_t>(MAX_NUMBER_OF_TASKS_IN_QUEUE), statistics._tasks);
+    ASSERT_LE(statistics._stolenTasks, statistics._tasks);
+    ASSERT_GT(statistics._taskRate, 0);
+    ASSERT_GE(statistics._averageQueueWaitTime, 0);
+}
+
+
+TEST(CPUStreamsExecutorTests, runOnNumaNodeExecutesTasksOnStreamsOfTheNode) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    auto numaNodes = taskExecutor->GetUsedNumaNodes();
+    ASSERT_FALSE(numaNodes.empty());
+    for (auto numaNodeId : numaNodes) {
+        auto promise = std::make_shared<std::promise<int>>();
+        auto future = promise->get_future();
+        auto executor = taskExecutor.get();
+        taskExecutor->RunOnNumaNode([promise, executor] {
+            promise->set_value(executor->GetNumaNodeId());
+        }, numaNodeId);
+        // an idle stream of another node may steal the task
+        ASSERT_NE(numaNodes.end(), std::find(numaNodes.begin(), numaNodes.end(), future.get()));
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ie_parallel.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/clamp_fusion.hpp>
+#include <transformations/common_optimizations/hsigmoid_fusion.hpp>
+#include <transformations/common_optimizations/hswish_fusion.hpp>
+#include <transformations/common_optimizations/softplus_fusion.hpp>
+#include <transformations/common_optimizations/softplus_to_mish_fusion.hpp>
+#include <transformations/common_optimizations/swish_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+// Enough branches to match the patterns in parallel. SoftPlus -> Mish fusion is a cascade: Multiply matches
+// only after Log is replaced with SoftPlus, so the results of the parallel matching must not be reused for it.
+std::shared_ptr<ngraph::Function> get_fusions_function() {
+    const size_t branches = 500;
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    data->set_friendly_name("data");
+
+    ngraph::NodeVector results;
+    auto add_named = [&](const std::shared_ptr<ngraph::Node>& node, const std::string& name) {
+        node->set_friendly_name(name);
+        return node;
+    };
+    auto constant = [&](float value, const std::string& name) {
+        return add_named(ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {value}), name);
+    };
+    for (size_t i = 0; i < branches; ++i) {
+        const auto prefix = "branch_" + std::to_string(i) + "/";
+
+        // x * tanh(log(exp(x) + 1))
+        auto exp = add_named(std::make_shared<ngraph::opset6::Exp>(data), prefix + "exp");
+        auto add_one = add_named(std::make_shared<ngraph::opset6::Add>(exp, constant(1.f, prefix + "one")), prefix + "add_one");
+        auto log = add_named(std::make_shared<ngraph::opset6::Log>(add_one), prefix + "log");
+        auto tanh = add_named(std::make_shared<ngraph::opset6::Tanh>(log), prefix + "tanh");
+        auto mish = add_named(std::make_shared<ngraph::opset6::Multiply>(data, tanh), prefix + "mish");
+
+        // x * min(relu(x + 3), 6) / 6
+        auto add_three = add_named(std::make_shared<ngraph::opset6::Add>(mish, constant(3.f, prefix + "three")), prefix + "add_three");
+        auto relu = add_named(std::make_shared<ngraph::opset6::Relu>(add_three), prefix + "relu");
+        auto min = add_named(std::make_shared<ngraph::opset6::Minimum>(relu, constant(6.f, prefix + "six")), prefix + "min");
+        auto mul = add_named(std::make_shared<ngraph::opset6::Multiply>(mish, min), prefix + "mul");
+        auto hswish = add_named(std::make_shared<ngraph::opset6::Divide>(mul, constant(6.f, prefix + "div_six")), prefix + "hswish");
+
+        // min(max(x, 0), 6)
+        auto max = add_named(std::make_shared<ngraph::opset6::Maximum>(hswish, constant(0.f, prefix + "zero")), prefix + "max");
+        auto clamp = add_named(std::make_shared<ngraph::opset6::Minimum>(max, constant(6.f, prefix + "clamp_six")), prefix + "clamp");
+        results.push_back(clamp);
+    }
+    return std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{data});
+}
+
+void run_fusions(const std::shared_ptr<ngraph::Function>& f, bool parallel) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    auto fusions = manager.register_pass<ngraph::pass::GraphRewrite>();
+    fusions->add_matcher<ngraph::pass::SoftPlusFusion>();
+    fusions->add_matcher<ngraph::pass::SoftPlusToMishFusion>();
+    fusions->add_matcher<ngraph::pass::SwishFusion>();
+    fusions->add_matcher<ngraph::pass::HSwishFusion>();
+    fusions->add_matcher<ngraph::pass::HSigmoidFusion>();
+    fusions->add_matcher<ngraph::pass::ClampFusion>();
+    if (parallel) {
+        fusions->set_parallel_matching([](size_t count, const std::function<void(size_t)>& func) {
+            InferenceEngine::parallel_for(count, func);
+        });
+    }
+    manager.run_passes(f);
+}
+
+}  // namespace
+
+TEST(TransformationTests, ParallelMatchingIsEqualToSequential) {
+    auto f = get_fusions_function();
+    run_fusions(f, false);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto f_parallel = get_fusions_function();
+    run_fusions(f_parallel, true);
+    ASSERT_NO_THROW(check_rt_info(f_parallel));
+
+    auto res = compare_functions(f, f_parallel, true, true, true, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+
+    const auto ops = f->get_ordered_ops();
+    const auto parallel_ops = f_parallel->get_ordered_ops();
+    ASSERT_EQ(ops.size(), parallel_ops.size());
+    for (size_t i = 0; i < ops.size(); ++i) {
+        ASSERT_EQ(ops[i]->get_friendly_name(), parallel_ops[i]->get_friendly_name());
+        ASSERT_EQ(ngraph::getFusedNames(ops[i]), ngraph::getFusedNames(parallel_ops[i]));
+    }
+
+    // all the patterns are fused, including the cascade
+    size_t mish_count = 0, hswish_count = 0, clamp_count = 0;
+    for (const auto& op : parallel_ops) {
+        mish_count += ngraph::is_type<ngraph::opset6::Mish>(op) ? 1 : 0;
+        hswish_count += ngraph::is_type<ngraph::opset6::HSwish>(op) ? 1 : 0;
+        clamp_count += ngraph::is_type<ngraph::opset6::Clamp>(op) ? 1 : 0;
+    }
+    ASSERT_EQ(500, mish_count);
+    ASSERT_EQ(500, hswish_count);
+    ASSERT_EQ(500, clamp_count);
+}
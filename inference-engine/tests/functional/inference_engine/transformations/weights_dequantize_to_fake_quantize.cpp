@@ -93,3 +93,116 @@ INSTANTIATE_TEST_CASE_P(NGraph, TranslateNewWeightFormatToOldOne, testing::Combi
         testing::Values(
             ngraph::element::f32,
             ngraph::element::f16)));
+
+TEST(TransformationTests, WeightsDequantizeToFakeQuantizeKeepsU8WeightsCompressed) {
+    std::shared_ptr<ngraph::Function> f, f_ref;
+    std::vector<uint8_t> weights{0, 7, 255};
+    {
+        auto u_weights = std::make_shared<ngraph::opset6::Constant>(ngraph::element::u8, ngraph::Shape{weights.size()}, weights);
+        auto f_weights = std::make_shared<ngraph::opset6::Convert>(u_weights, ngraph::element::f32);
+        auto zp = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {8});
+        auto subtract_zp = std::make_shared<ngraph::opset6::Subtract>(f_weights, zp);
+        auto scale = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5});
+        auto multiply = std::make_shared<ngraph::opset6::Multiply>(subtract_zp, scale);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{multiply}, ngraph::ParameterVector{});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::WeightsDequantizeToFakeQuantize>(true);
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+
+        ASSERT_EQ(f_weights->get_rt_info().count("DISABLED_CONSTANT_FOLDING"), 1);
+    }
+
+    {
+        auto u_weights = std::make_shared<ngraph::opset6::Constant>(ngraph::element::u8, ngraph::Shape{weights.size()}, weights);
+        auto f_weights = std::make_shared<ngraph::opset6::Convert>(u_weights, ngraph::element::f32);
+        auto i_low = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0});
+        auto i_high = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {255});
+        auto o_low = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {(0 - 8) * 0.5});
+        auto o_high = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {(255 - 8) * 0.5});
+        auto fq = std::make_shared<ngraph::opset6::FakeQuantize>(f_weights, i_low, i_high, o_low, o_high, 256);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{fq}, ngraph::ParameterVector{});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+namespace {
+
+std::shared_ptr<ngraph::Node> dequantize_weights(ngraph::element::Type type, const ngraph::Shape& shape, const std::vector<int>& weights) {
+    auto q_weights = ngraph::opset6::Constant::create(type, shape, weights);
+    auto f_weights = std::make_shared<ngraph::opset6::Convert>(q_weights, ngraph::element::f32);
+    auto zp = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2});
+    auto subtract_zp = std::make_shared<ngraph::opset6::Subtract>(f_weights, zp);
+    auto scale = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5});
+    return std::make_shared<ngraph::opset6::Multiply>(subtract_zp, scale);
+}
+
+}  // namespace
+
+// The same callback as the CPU plugin uses: only 2D weights of MatMul operations are kept compressed
+TEST(TransformationTests, WeightsDequantizeToFakeQuantizeKeepsMatMulWeightsCompressed) {
+    std::shared_ptr<ngraph::Function> f, f_ref;
+    const std::vector<int> weights{0, 7, 255, 3, 1, 2};
+    const std::vector<int> i_weights{-128, 7, 127, 3, -1, 2};
+    {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3});
+        auto matmul = std::make_shared<ngraph::opset6::MatMul>(data, dequantize_weights(ngraph::element::u8, ngraph::Shape{2, 3}, weights),
+                                                               false, true);
+        auto i_matmul = std::make_shared<ngraph::opset6::MatMul>(data, dequantize_weights(ngraph::element::i8, ngraph::Shape{3, 2}, i_weights));
+        auto add = std::make_shared<ngraph::opset6::Add>(data, dequantize_weights(ngraph::element::u8, ngraph::Shape{2, 3}, weights));
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul, i_matmul, add}, ngraph::ParameterVector{data});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::WeightsDequantizeToFakeQuantize>(true);
+        manager.get_pass_config()->set_callback<ngraph::pass::WeightsDequantizeToFakeQuantize>(
+                [](const std::shared_ptr<const ngraph::Node> &node) -> bool {
+                    const auto consumers = node->get_output_target_inputs(0);
+                    return consumers.size() != 1 || consumers.begin()->get_index() != 1 ||
+                           !ngraph::is_type<ngraph::opset1::MatMul>(consumers.begin()->get_node()) ||
+                           node->get_output_partial_shape(0).rank() != 2;
+                });
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto compressed_weights = [](ngraph::element::Type type, const ngraph::Shape& shape, const std::vector<int>& weights,
+                                     float in_low, float in_high, size_t levels) {
+            auto q_weights = ngraph::opset6::Constant::create(type, shape, weights);
+            auto f_weights = std::make_shared<ngraph::opset6::Convert>(q_weights, ngraph::element::f32);
+            auto i_low = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {in_low});
+            auto i_high = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {in_high});
+            auto o_low = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {(in_low - 2) * 0.5});
+            auto o_high = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{}, {(in_high - 2) * 0.5});
+            return std::make_shared<ngraph::opset6::FakeQuantize>(f_weights, i_low, i_high, o_low, o_high, levels);
+        };
+
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3});
+        auto matmul = std::make_shared<ngraph::opset6::MatMul>(data, compressed_weights(ngraph::element::u8, ngraph::Shape{2, 3}, weights, 0, 255, 256),
+                                                               false, true);
+        auto i_matmul = std::make_shared<ngraph::opset6::MatMul>(data,
+                                                                 compressed_weights(ngraph::element::i8, ngraph::Shape{3, 2}, i_weights, -128, 127, 256));
+        auto add = std::make_shared<ngraph::opset6::Add>(data, dequantize_weights(ngraph::element::u8, ngraph::Shape{2, 3}, weights));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul, i_matmul, add}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+
+    // the Convert of the compressed weights must survive the constant folding, the rest of the weights are folded as usual
+    size_t not_foldable_converts = 0;
+    for (const auto& op : f->get_ops()) {
+        if (ngraph::is_type<ngraph::opset6::Convert>(op))
+            not_foldable_converts += op->get_rt_info().count("DISABLED_CONSTANT_FOLDING");
+    }
+    ASSERT_EQ(not_foldable_converts, 2);
+}
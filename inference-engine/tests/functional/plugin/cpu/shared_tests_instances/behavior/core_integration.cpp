@@ -23,7 +23,7 @@ INSTANTIATE_TEST_CASE_P(
 
 INSTANTIATE_TEST_CASE_P(
         smoke_IEClassImportExportTestP, IEClassImportExportTestP,
-        ::testing::Values("HETERO:CPU"));
+        ::testing::Values("HETERO:CPU", "CPU"));
 
 //
 // IE Class GetMetric
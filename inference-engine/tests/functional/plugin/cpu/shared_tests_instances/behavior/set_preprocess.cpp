@@ -4,6 +4,7 @@
 
 #include <base/behavior_test_utils.hpp>
 #include "multi-device/multi_device_config.hpp"
+#include <cpu/cpu_config.hpp>
 
 #include "behavior/set_preprocess.hpp"
 
@@ -17,7 +18,8 @@ namespace {
     const std::vector<std::map<std::string, std::string>> configs = {
             {},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, InferenceEngine::PluginConfigParams::CPU_THROUGHPUT_AUTO}},
-            {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}}
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PREPROCESSING_STREAMS, "1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiConfigs = {
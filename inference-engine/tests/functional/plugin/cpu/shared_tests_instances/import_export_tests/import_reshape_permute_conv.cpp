@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_reshape_permute_conv.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::FP16,
+};
+
+const std::vector<std::map<std::string, std::string>> exportConfigs = {
+    {}
+};
+
+const std::vector<std::map<std::string, std::string>> importConfigs = {
+    {}
+};
+
+const std::vector<std::string> appHeaders = {
+        "",
+        "APPLICATION_HEADER"
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkCase, ImportReshapePermuteConv,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::ValuesIn(exportConfigs),
+                            ::testing::ValuesIn(importConfigs),
+                            ::testing::ValuesIn(appHeaders)),
+                        ImportReshapePermuteConv::getTestCaseName);
+
+} // namespace
@@ -58,6 +58,31 @@ const auto params3Inputs = ::testing::Combine(
 
 INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput3In, DetectionOutputLayerTest, params3Inputs, DetectionOutputLayerTest::getTestCaseName);
 
+/* =============== top_k and keep_top_k: all candidates, cut before and after NMS, Caffe and MXNet styles =============== */
+
+const auto topKAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(backgroundLabelId),
+        ::testing::Values(-1, 10),
+        ::testing::Values(std::vector<int>{-1}, std::vector<int>{10}),
+        ::testing::ValuesIn(codeType),
+        ::testing::Values(nmsThreshold),
+        ::testing::Values(confidenceThreshold),
+        ::testing::Values(false),
+        ::testing::Values(false),
+        ::testing::ValuesIn(decreaseLabelId)
+);
+
+const auto params3InputsTopK = ::testing::Combine(
+        topKAttributes,
+        ::testing::ValuesIn(specificParams3In),
+        ::testing::ValuesIn(numberBatch),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput3InTopK, DetectionOutputLayerTest, params3InputsTopK, DetectionOutputLayerTest::getTestCaseName);
+
 /* =============== 5 inputs cases =============== */
 
 const std::vector<ParamsWhichSizeDepends> specificParams5In = {
@@ -46,4 +46,29 @@ INSTANTIATE_TEST_CASE_P(smoke, EmbeddingBagOffsetsSumLayerTest,
                                 ::testing::ValuesIn(indPrecisions),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         EmbeddingBagOffsetsSumLayerTest::getTestCaseName);
+
+// FP32 rows are accumulated by the kernel: widths shorter than a vector, with a tail after vectors and
+// after chunks of four vectors; empty bags with and without the default index, and a long bag split between threads
+const std::vector<std::vector<size_t>> kernel_emb_table_shape = {{50, 3}, {50, 13}, {50, 45}, {50, 70}};
+const std::vector<std::vector<size_t>> kernel_indices = {
+        {0, 49, 3, 3, 7, 11, 5, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+         41, 42, 43, 44, 45, 46, 47, 48, 1, 2, 4, 6}};
+const std::vector<std::vector<size_t>> kernel_offsets = {{0, 2, 2, 6, 6, 7}};
+
+const auto embBagOffsetSumKernelArgSet = ::testing::Combine(
+        ::testing::ValuesIn(kernel_emb_table_shape),
+        ::testing::ValuesIn(kernel_indices),
+        ::testing::ValuesIn(kernel_offsets),
+        ::testing::ValuesIn(default_index),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_Kernel, EmbeddingBagOffsetsSumLayerTest,
+                        ::testing::Combine(
+                                embBagOffsetSumKernelArgSet,
+                                ::testing::Values(InferenceEngine::Precision::FP32),
+                                ::testing::ValuesIn(indPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagOffsetsSumLayerTest::getTestCaseName);
 }  // namespace
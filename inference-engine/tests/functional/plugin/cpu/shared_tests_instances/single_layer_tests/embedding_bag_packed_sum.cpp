@@ -40,4 +40,25 @@ INSTANTIATE_TEST_CASE_P(smoke, EmbeddingBagPackedSumLayerTest,
                                 ::testing::ValuesIn(indPrecisions),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         EmbeddingBagPackedSumLayerTest::getTestCaseName);
+
+// FP32 rows are accumulated by the kernel: widths shorter than a vector, with a tail after vectors and
+// after chunks of four vectors
+const std::vector<std::vector<size_t>> kernel_emb_table_shape = {{50, 3}, {50, 13}, {50, 45}, {50, 70}};
+const std::vector<std::vector<std::vector<size_t>>> kernel_indices = {
+        {{0, 49, 3, 3, 7, 11, 5, 20, 21, 22, 23, 24}, {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36},
+         {37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}}};
+
+const auto embBagPackedSumKernelArgSet = ::testing::Combine(
+        ::testing::ValuesIn(kernel_emb_table_shape),
+        ::testing::ValuesIn(kernel_indices),
+        ::testing::ValuesIn(with_weights)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_Kernel, EmbeddingBagPackedSumLayerTest,
+                        ::testing::Combine(
+                                embBagPackedSumKernelArgSet,
+                                ::testing::Values(InferenceEngine::Precision::FP32),
+                                ::testing::ValuesIn(indPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagPackedSumLayerTest::getTestCaseName);
 }  // namespace
@@ -48,4 +48,31 @@ INSTANTIATE_TEST_CASE_P(smoke, EmbeddingSegmentsSumLayerTest,
                                 ::testing::ValuesIn(indPrecisions),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         EmbeddingSegmentsSumLayerTest::getTestCaseName);
+
+// FP32 rows are accumulated by the kernel: widths shorter than a vector, with a tail after vectors and
+// after chunks of four vectors; empty segments in the middle and at the end with and without the default index
+const std::vector<std::vector<size_t>> kernel_emb_table_shape = {{50, 3}, {50, 13}, {50, 45}, {50, 70}};
+const std::vector<std::vector<size_t>> kernel_indices = {
+        {0, 49, 3, 3, 7, 11, 5, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}};
+const std::vector<std::vector<size_t>> kernel_segment_ids = {
+        {0, 0, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4}};
+const std::vector<size_t> kernel_num_segments = {7};
+
+const auto embSegmentsSumKernelArgSet = ::testing::Combine(
+        ::testing::ValuesIn(kernel_emb_table_shape),
+        ::testing::ValuesIn(kernel_indices),
+        ::testing::ValuesIn(kernel_segment_ids),
+        ::testing::ValuesIn(kernel_num_segments),
+        ::testing::ValuesIn(default_index),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_Kernel, EmbeddingSegmentsSumLayerTest,
+                        ::testing::Combine(
+                                embSegmentsSumKernelArgSet,
+                                ::testing::Values(InferenceEngine::Precision::FP32),
+                                ::testing::ValuesIn(indPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingSegmentsSumLayerTest::getTestCaseName);
 }  // namespace
@@ -73,4 +73,36 @@ INSTANTIATE_TEST_CASE_P(smoke_set5, GatherElementsLayerTest,
                             ::testing::ValuesIn(iPrecisions),
                             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         GatherElementsLayerTest::getTestCaseName);
+
+// Rows of the last axis longer than a vector, gathered with the vector body and the tail
+INSTANTIATE_TEST_CASE_P(smoke_set6, GatherElementsLayerTest,
+                        ::testing::Combine(
+                            ::testing::Values(std::vector<size_t>({3, 4, 6})),    // Data shape
+                            ::testing::Values(std::vector<size_t>({3, 4, 17})),   // Indices shape
+                            ::testing::Values(2, -1),                             // Axis
+                            ::testing::ValuesIn(dPrecisions),
+                            ::testing::ValuesIn(iPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        GatherElementsLayerTest::getTestCaseName);
+
+// Elements of an outer axis are gathered by linear offsets within inner blocks shorter and longer than a vector
+INSTANTIATE_TEST_CASE_P(smoke_set7, GatherElementsLayerTest,
+                        ::testing::Combine(
+                            ::testing::Values(std::vector<size_t>({4, 3, 5})),    // Data shape
+                            ::testing::Values(std::vector<size_t>({4, 9, 5})),    // Indices shape
+                            ::testing::Values(1, -2),                             // Axis
+                            ::testing::ValuesIn(dPrecisions),
+                            ::testing::ValuesIn(iPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        GatherElementsLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_set8, GatherElementsLayerTest,
+                        ::testing::Combine(
+                            ::testing::Values(std::vector<size_t>({4, 3, 37})),   // Data shape
+                            ::testing::Values(std::vector<size_t>({4, 9, 37})),   // Indices shape
+                            ::testing::Values(1, -2),                             // Axis
+                            ::testing::ValuesIn(dPrecisions),
+                            ::testing::ValuesIn(iPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        GatherElementsLayerTest::getTestCaseName);
 }  // namespace
@@ -55,4 +55,21 @@ INSTANTIATE_TEST_CASE_P(smoke_Set2, GatherNDLayerTest,
                             ::testing::Values(CommonTestUtils::DEVICE_CPU),
                             ::testing::Values<Config>({})),
                         GatherNDLayerTest::getTestCaseName);
+
+// Slices addressed by a single index are copied as rows: single elements, short rows and long rows
+const auto gatherNDArgsSubset3 = ::testing::Combine(
+        ::testing::ValuesIn(std::vector<std::vector<size_t>>(
+            {{10, 7}, {10, 3, 20}, {10, 3, 100}})),               // Data shape
+        ::testing::ValuesIn(std::vector<std::vector<size_t>>(
+            {{10, 9, 1}})),                                       // Indices shape
+        ::testing::ValuesIn(std::vector<int>({0, 1}))             // Batch dims
+);
+INSTANTIATE_TEST_CASE_P(smoke_Set3, GatherNDLayerTest,
+                        ::testing::Combine(
+                            gatherNDArgsSubset3,
+                            ::testing::ValuesIn(dPrecisions),
+                            ::testing::ValuesIn(iPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::Values<Config>({})),
+                        GatherNDLayerTest::getTestCaseName);
 }  // namespace
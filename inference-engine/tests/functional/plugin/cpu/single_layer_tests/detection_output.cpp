@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/single_layer/detection_output.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace CPULayerTestsDefinitions {
+
+/* Confidences of a few levels only, so many priors of a class are tied and have to be ordered by the prior index
+   like in the reference. The ordering of ties across classes isn't defined by the reference, so only the Caffe style
+   is checked, and keep_top_k doesn't cut the detections.
+ */
+class DetectionOutputTiedScoresCPUTest : public DetectionOutputLayerTest {
+public:
+    void GenerateInputs() override {
+        DetectionOutputLayerTest::GenerateInputs();
+        CommonTestUtils::fill_data_random_float<InferenceEngine::Precision::FP32>(inputs[idxConfidence], 1, 0, 4);
+    }
+};
+
+TEST_P(DetectionOutputTiedScoresCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const int numClasses = 11;
+
+const auto tiedScoresAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(0),                                   // backgroundLabelId
+        ::testing::Values(-1, 5, 20),                           // topK
+        ::testing::Values(std::vector<int>{numClasses * 60}),   // keepTopK
+        ::testing::Values("caffe.PriorBoxParameter.CORNER", "caffe.PriorBoxParameter.CENTER_SIZE"),
+        ::testing::Values(0.5f),                                // nmsThreshold
+        ::testing::Values(0.3f),                                // confidenceThreshold
+        ::testing::Values(false),                               // clipAfterNms
+        ::testing::Values(false),                               // clipBeforeNms
+        ::testing::Values(false)                                // decreaseLabelId
+);
+
+const std::vector<ParamsWhichSizeDepends> specificParams = {
+    ParamsWhichSizeDepends{true, true, true, 1, 1, {1, 240}, {1, 660}, {1, 1, 240}, {}, {}},
+    ParamsWhichSizeDepends{false, false, true, 1, 1, {1, 2640}, {1, 660}, {1, 2, 240}, {}, {}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputTiedScores_CPU, DetectionOutputTiedScoresCPUTest,
+                        ::testing::Combine(
+                            tiedScoresAttributes,
+                            ::testing::ValuesIn(specificParams),
+                            ::testing::Values(1, 2),
+                            ::testing::Values(0.0f),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        DetectionOutputLayerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,150 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions  {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Data shape
+        std::vector<int>,       // Indices
+        std::vector<size_t>,    // Indices shape
+        int,                    // Axis
+        Precision               // Data precision
+> GatherCPUTestParamSet;
+
+/* The CPU Gather copies rows of the data as raw bytes and fills the rows addressed by indices
+   out of [0, data.shape[axis]) with zeros, so the reference is computed the same way.
+ */
+class GatherCPUTest : public testing::WithParamInterface<GatherCPUTestParamSet>,
+                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<GatherCPUTestParamSet> &obj) {
+        std::vector<size_t> dataShape, indicesShape;
+        std::vector<int> indices;
+        int axis;
+        Precision dPrecision;
+        std::tie(dataShape, indices, indicesShape, axis, dPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(dataShape) << "_";
+        result << "axis=" << axis << "_";
+        result << "indices=" << CommonTestUtils::vec2str(indices) << "_";
+        result << "indicesShape=" << CommonTestUtils::vec2str(indicesShape) << "_";
+        result << "dPRC=" << dPrecision.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> indicesShape;
+        Precision dPrecision;
+        std::tie(dataShape, indices, indicesShape, axis, dPrecision) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = outPrc = dPrecision;
+        if (axis < 0)
+            axis += static_cast<int>(dataShape.size());
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(dPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {dataShape});
+        auto indicesNode = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape(indicesShape), indices);
+        auto axisNode = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape({}), {axis});
+        auto gather = std::make_shared<ngraph::opset1::Gather>(params[0], indicesNode, axisNode);
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{gather}, params, "Gather");
+    }
+
+    std::vector<std::vector<std::uint8_t>> CalculateRefs() override {
+        const auto& data = inputs[0];
+        const size_t elementSize = data->getTensorDesc().getPrecision().size();
+        size_t outerSize = 1, rowSize = elementSize;
+        for (int i = 0; i < axis; i++)
+            outerSize *= dataShape[i];
+        for (size_t i = axis + 1; i < dataShape.size(); i++)
+            rowSize *= dataShape[i];
+        const int indexRange = static_cast<int>(dataShape[axis]);
+
+        auto src = data->cbuffer().as<const uint8_t*>();
+        std::vector<std::uint8_t> expected(outerSize * indices.size() * rowSize, 0);
+        for (size_t outer = 0; outer < outerSize; outer++) {
+            for (size_t i = 0; i < indices.size(); i++) {
+                if (indices[i] < 0 || indices[i] >= indexRange)
+                    continue;
+                std::memcpy(&expected[(outer * indices.size() + i) * rowSize],
+                            &src[(outer * indexRange + indices[i]) * rowSize], rowSize);
+            }
+        }
+        return {expected};
+    }
+
+    std::vector<size_t> dataShape;
+    std::vector<int> indices;
+    int axis;
+};
+
+TEST_P(GatherCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+// 1, 2 and 4 byte data: single element rows are gathered by vpgatherdd on AVX2 and AVX-512
+const std::vector<Precision> dPrecisions = {
+        Precision::FP32,
+        Precision::BF16,
+        Precision::I8,
+        Precision::U8
+};
+
+// more indices than lanes of a vector, so both the vector body and the tail are executed
+const std::vector<int> validIndices = {0, 3, 2, 1, 4, 4, 0, 2, 1, 3, 0, 1, 2, 4, 3, 2, 1};
+
+INSTANTIATE_TEST_CASE_P(smoke_GatherElementRows_CPU, GatherCPUTest,
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>({3, 5})),
+                ::testing::Values(validIndices),
+                ::testing::Values(std::vector<size_t>({17})),
+                ::testing::Values(1, -1),
+                ::testing::ValuesIn(dPrecisions)),
+        GatherCPUTest::getTestCaseName);
+
+// rows shorter than a vector and rows of several vectors are copied by the row loop of the kernel
+INSTANTIATE_TEST_CASE_P(smoke_GatherShortRows_CPU, GatherCPUTest,
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>({5, 5, 3}), std::vector<size_t>({5, 6, 21})),
+                ::testing::Values(validIndices),
+                ::testing::Values(std::vector<size_t>({17})),
+                ::testing::Values(0, 1),
+                ::testing::ValuesIn(dPrecisions)),
+        GatherCPUTest::getTestCaseName);
+
+// rows longer than the kernel handles are copied by cpu_memcpy
+INSTANTIATE_TEST_CASE_P(smoke_GatherLongRows_CPU, GatherCPUTest,
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>({5, 300})),
+                ::testing::Values(std::vector<int>({4, 0, 3})),
+                ::testing::Values(std::vector<size_t>({3})),
+                ::testing::Values(0),
+                ::testing::ValuesIn(dPrecisions)),
+        GatherCPUTest::getTestCaseName);
+
+// negative and out of range indices produce zero rows
+const std::vector<int> invalidIndices = {0, -1, 2, 5, 4, -5, 1, 100, 3, 2, -100, 4, 0, 6, 1};
+
+INSTANTIATE_TEST_CASE_P(smoke_GatherInvalidIndices_CPU, GatherCPUTest,
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>({3, 5}), std::vector<size_t>({5, 2, 3})),
+                ::testing::Values(invalidIndices),
+                ::testing::Values(std::vector<size_t>({3, 5})),
+                ::testing::Values(0, 1),
+                ::testing::ValuesIn(dPrecisions)),
+        GatherCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
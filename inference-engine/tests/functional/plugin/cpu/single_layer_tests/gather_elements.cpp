@@ -88,5 +88,18 @@ INSTANTIATE_TEST_CASE_P(smoke_set1, GatherElementsCPUTest,
                 ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
         GatherElementsCPUTest::getTestCaseName);
 
+// 2 byte elements of the last axis are gathered by vpgatherdd
+INSTANTIATE_TEST_CASE_P(smoke_set2, GatherElementsCPUTest,
+            ::testing::Combine(
+                ::testing::Combine(
+                    ::testing::Values(std::vector<size_t>({2, 3, 4, 6})),    // Data shape
+                    ::testing::Values(std::vector<size_t>({2, 3, 4, 17})),   // Indices shape
+                    ::testing::ValuesIn(std::vector<int>({3, -1})),          // Axis
+                    ::testing::Values(Precision::BF16),
+                    ::testing::Values(Precision::I32),
+                    ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D))),
+        GatherElementsCPUTest::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
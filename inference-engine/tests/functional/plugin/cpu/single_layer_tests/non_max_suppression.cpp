@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/single_layer/non_max_suppression.hpp"
+
+using namespace LayerTestsDefinitions;
+using namespace InferenceEngine;
+using namespace ngraph;
+
+namespace CPULayerTestsDefinitions {
+
+/* Scores of a few levels only, so many candidates are tied and have to be ordered by the box index
+   like in the reference, also across the chunks of candidates sorted by the plugin.
+ */
+class NmsTiedScoresCPUTest : public NmsLayerTest {
+public:
+    void GenerateInputs() override {
+        NmsLayerTest::GenerateInputs();
+        CommonTestUtils::fill_data_random_float<Precision::FP32>(inputs[1], 1, 0, 4);
+    }
+};
+
+TEST_P(NmsTiedScoresCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<InputShapeParams> inShapeParams = {
+    InputShapeParams{2, 200, 3},
+    InputShapeParams{1, 50, 10}
+};
+
+// less and more boxes per class than the first chunk of the sorted candidates
+const std::vector<int32_t> maxOutBoxPerClass = {1, 5, 150};
+
+const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
+                                          ::testing::Combine(::testing::Values(Precision::FP32),
+                                                             ::testing::Values(Precision::I32),
+                                                             ::testing::Values(Precision::FP32)),
+                                          ::testing::ValuesIn(maxOutBoxPerClass),
+                                          ::testing::Values(0.3f, 0.7f),
+                                          ::testing::Values(0.f, 0.3f),
+                                          ::testing::Values(0.f),
+                                          ::testing::Values(op::v5::NonMaxSuppression::BoxEncodingType::CORNER),
+                                          ::testing::Values(true, false),
+                                          ::testing::Values(element::i32),
+                                          ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_NmsTiedScores_CPU, NmsTiedScoresCPUTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class AutoBatchTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 4, 8}});
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4, 1}, {2.f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(params[0], scale);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "AutoBatch");
+    }
+
+    // Convolution and FullyConnected get primitives created for the batch
+    void BuildConvolutionGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 8, 8}});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, 8, true);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(convolution);
+        // the batch is kept by the special zero, so the network can be reshaped to other batches
+        auto pattern = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {0, -1});
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(relu, pattern, true);
+        auto fullyConnected = ngraph::builder::makeFullyConnected(reshape, ngraph::element::f32, 10);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(fullyConnected)};
+        function = std::make_shared<ngraph::Function>(results, params, "AutoBatchConvolution");
+    }
+
+    // Every request gets its own input, so outputs mixed up between the requests of a batch are detected.
+    // The outputs are compared with the ones of the network inferred without batching.
+    void InferAndCheck(size_t requestsCount) {
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto& outputName = executableNetwork.GetOutputsInfo().begin()->first;
+        auto referenceNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice);
+        auto referenceRequest = referenceNetwork.CreateInferRequest();
+
+        std::vector<InferRequest> requests;
+        for (size_t r = 0; r < requestsCount; r++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            auto input = requests.back().GetBlob(inputName);
+            auto inputData = input->buffer().as<float*>();
+            for (size_t i = 0; i < input->size(); i++)
+                inputData[i] = static_cast<float>((i + r) % 7) - 3.f;
+        }
+        for (auto& request : requests)
+            request.StartAsync();
+
+        for (size_t r = 0; r < requestsCount; r++) {
+            ASSERT_EQ(StatusCode::OK, requests[r].Wait(IInferRequest::WaitMode::RESULT_READY));
+            referenceRequest.SetBlob(inputName, requests[r].GetBlob(inputName));
+            referenceRequest.Infer();
+
+            auto output = requests[r].GetBlob(outputName);
+            auto referenceOutput = referenceRequest.GetBlob(outputName);
+            ASSERT_EQ(referenceOutput->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+            auto outputData = output->cbuffer().as<const float*>();
+            auto referenceData = referenceOutput->cbuffer().as<const float*>();
+            for (size_t i = 0; i < output->size(); i++)
+                ASSERT_NEAR(referenceData[i], outputData[i], 1e-4f * std::max(1.f, std::abs(referenceData[i])));
+        }
+    }
+};
+
+namespace {
+
+TEST_F(AutoBatchTest, smoke_AutoBatch_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE] = "4";
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT] = "100000";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+
+    InferAndCheck(4);
+}
+
+TEST_F(AutoBatchTest, smoke_AutoBatchIncomplete_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE] = "4";
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT] = "1000";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+
+    // Incomplete batches are padded, a single request is inferred by itself
+    InferAndCheck(3);
+    InferAndCheck(1);
+    InferAndCheck(6);
+}
+
+TEST_F(AutoBatchTest, smoke_AutoBatchConvolution_CPU) {
+    BuildConvolutionGraph();
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE] = "4";
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT] = "100000";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+
+    InferAndCheck(4);
+    InferAndCheck(8);
+}
+
+TEST_F(AutoBatchTest, smoke_AutoBatchConvolutionPartialLastBatch_CPU) {
+    BuildConvolutionGraph();
+    // the maximal batch isn't a power of two and 7 requests don't fill the last batch, 2 requests fill a smaller one
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_SIZE] = "3";
+    configuration[CPUConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT] = "1000";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+
+    InferAndCheck(7);
+    InferAndCheck(2);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class DirectGraphTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 8}, {1, 3, 8}});
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(params[1], 2);
+        auto constant = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3, 4}, {}, true);
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{params[0], constant, softmax}, -1);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat),
+                                     std::make_shared<ngraph::opset1::Result>(softmax)};
+        function = std::make_shared<ngraph::Function>(results, params, "DirectGraph");
+    }
+
+    void BuildConvolutionGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 3, 16, 16}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16, true);
+        auto pool = ngraph::builder::makePooling(conv, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(pool)};
+        function = std::make_shared<ngraph::Function>(results, params, "DirectConvolutionGraph");
+    }
+};
+
+namespace {
+/* All the operations have nodes which are created from ngraph, so the graph is built without CNNNetwork
+
+    Parameter  Constant  Parameter
+        \         |        |
+         \        |     Softmax
+          \       |     /     \
+            Concat(-1)       Output
+               |
+             Output
+*/
+
+TEST_F(DirectGraphTest, smoke_DirectGraph_CPU) {
+    BuildGraph();
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Concatenation", 1);
+    CheckNodeOfTypeCount(executableNetwork, "SoftMax", 1);
+}
+
+/* The weights and the biases stay Constant inputs of the Convolution node instead of the legacy layer blobs,
+   so the execution graph has an Input node for each of them
+
+    Parameter  Constant(weights)  Constant(biases)
+         \            |             /
+                  Convolution
+                      |
+                 MaxPool(2x2)
+                      |
+                    Output
+*/
+
+TEST_F(DirectGraphTest, smoke_DirectGraphConvolution_CPU) {
+    BuildConvolutionGraph();
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convolution", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Pooling", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Input", 3);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,129 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class MemoryStateTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 16}});
+        auto init = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 16}, {0.f});
+        auto read = std::make_shared<ngraph::opset3::ReadValue>(init, "state");
+        auto add = std::make_shared<ngraph::opset1::Add>(read, params[0]);
+        auto assign = std::make_shared<ngraph::opset3::Assign>(add, "state");
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1}, {2.f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+
+        assign->add_control_dependency(read);
+        multiply->add_control_dependency(assign);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "MemoryState");
+    }
+
+    void InferAndCheck(InferRequest& request, float expectedState) {
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto& outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+        auto input = make_shared_blob<float>({Precision::FP32, {1, 16}, Layout::NC});
+        input->allocate();
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = 1.f;
+
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        auto outputData = request.GetBlob(outputName)->cbuffer().as<const float*>();
+        auto states = request.QueryState();
+        ASSERT_EQ(1, states.size());
+        auto stateData = states[0].GetState()->cbuffer().as<const float*>();
+        for (size_t i = 0; i < 16; i++) {
+            ASSERT_EQ(expectedState, stateData[i]);
+            ASSERT_EQ(2.f * expectedState, outputData[i]);
+        }
+    }
+};
+
+namespace {
+/* The state is read and written by the graph in place, the buffers of the state are swapped after each inference
+
+    ReadValue   Parameter
+          \      /
+            Add
+          /     \
+    Assign    Multiply
+                 |
+               Output
+*/
+
+TEST_F(MemoryStateTest, smoke_MemoryState_CPU) {
+    BuildGraph();
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+
+    for (size_t step = 1; step <= 3; step++) {
+        InferAndCheck(request, static_cast<float>(step));
+    }
+
+    // The state is returned as the buffer the next inference reads from, not as a copy
+    auto states = request.QueryState();
+    ASSERT_EQ(states[0].GetState()->cbuffer().as<const void*>(), states[0].GetState()->cbuffer().as<const void*>());
+
+    // The state set by the user is copied to the memory of the plugin
+    auto newState = make_shared_blob<float>(states[0].GetState()->getTensorDesc());
+    newState->allocate();
+    auto newStateData = newState->buffer().as<float*>();
+    for (size_t i = 0; i < newState->size(); i++)
+        newStateData[i] = 10.f;
+    states[0].SetState(newState);
+    newStateData[0] = 100.f;
+    InferAndCheck(request, 11.f);
+    ASSERT_EQ(100.f, newStateData[0]);
+
+    states[0].Reset();
+    InferAndCheck(request, 1.f);
+}
+
+/* The state blob returned to the user isn't reused by the next inferences */
+TEST_F(MemoryStateTest, smoke_MemoryStateHeldBlobIsUnchanged_CPU) {
+    BuildGraph();
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+
+    InferAndCheck(request, 1.f);
+    auto heldState = request.QueryState()[0].GetState();
+    for (size_t step = 2; step <= 4; step++) {
+        InferAndCheck(request, static_cast<float>(step));
+    }
+
+    auto heldStateData = heldState->cbuffer().as<const float*>();
+    for (size_t i = 0; i < heldState->size(); i++) {
+        ASSERT_EQ(1.f, heldStateData[i]);
+    }
+}
+
+/* Requests sharing the graph keep their own states */
+TEST_F(MemoryStateTest, smoke_MemoryStateTwoRequests_CPU) {
+    BuildGraph();
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request1 = executableNetwork.CreateInferRequest();
+    auto request2 = executableNetwork.CreateInferRequest();
+
+    InferAndCheck(request1, 1.f);
+    InferAndCheck(request1, 2.f);
+    InferAndCheck(request2, 1.f);
+    InferAndCheck(request1, 3.f);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
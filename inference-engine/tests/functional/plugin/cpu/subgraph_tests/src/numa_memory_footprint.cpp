@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <cpu/cpu_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class NumaMemoryFootprintTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        std::vector<size_t> inputShape = {1, 8, 16, 16};
+        const size_t numOutChannels = 16;
+
+        InferenceEngine::Precision netPrecision = inPrc = outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, numOutChannels, true);
+        auto relu = ngraph::builder::makeActivation(conv, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "NumaMemoryFootprint");
+    }
+};
+
+namespace  {
+/* The footprint covers the memory of the stream graphs and the blobs of the infer requests */
+
+TEST_F(NumaMemoryFootprintTest, smoke_NumaMemoryFootprint_CPU) {
+    BuildGraph();
+    Run();
+
+    auto supportedMetrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(supportedMetrics.end(), std::find(supportedMetrics.begin(), supportedMetrics.end(),
+                                                METRIC_KEY(CPU_NUMA_MEMORY_FOOTPRINT)));
+
+    auto footprint = executableNetwork.GetMetric(METRIC_KEY(CPU_NUMA_MEMORY_FOOTPRINT)).as<std::map<int, std::uint64_t>>();
+    ASSERT_FALSE(footprint.empty());
+    std::uint64_t total = 0;
+    for (const auto& node : footprint)
+        total += node.second;
+    // at least the input and the output blobs of the request
+    const std::uint64_t blobsSize = (1 * 8 * 16 * 16 + 1 * 16 * 16 * 16) * sizeof(float);
+    ASSERT_GE(total, blobsSize);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class OutputZeroCopyTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph(Precision outputPrecision) {
+        std::vector<size_t> inputShape = {1, 8, 16, 16};
+        const size_t numOutChannels = 8;
+
+        InferenceEngine::Precision netPrecision = inPrc = Precision::FP32;
+        outPrc = outputPrecision;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, numOutChannels, true);
+        auto relu1 = ngraph::builder::makeActivation(conv1, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto conv2 = ngraph::builder::makeConvolution(relu1, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, numOutChannels, true);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu1),
+                                     std::make_shared<ngraph::opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, params, "OutputZeroCopy");
+    }
+};
+
+namespace  {
+/* The first output is also read by the next convolution, so the graph has to write it to the user blob
+   and read it back from there.
+
+        Parameter
+            |
+        Conv+Relu
+        /       \
+    Output    Conv
+                |
+              Output
+*/
+
+TEST_F(OutputZeroCopyTest, smoke_OutputZeroCopy_CPU) {
+    BuildGraph(Precision::FP32);
+    Run();
+}
+
+/* Non FP32 outputs are written to the user blobs directly as well */
+TEST_F(OutputZeroCopyTest, smoke_OutputZeroCopyI32_CPU) {
+    BuildGraph(Precision::I32);
+    Run();
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
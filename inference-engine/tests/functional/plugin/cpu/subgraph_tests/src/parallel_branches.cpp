@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class ParallelBranchesTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph(size_t branchesCount) {
+        std::vector<size_t> inputShape = {1, 8, 16, 16};
+        const size_t numOutChannels = 8;
+
+        InferenceEngine::Precision netPrecision = inPrc = outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES] = PluginConfigParams::YES;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+
+        ngraph::OutputVector branches;
+        for (size_t i = 0; i < branchesCount; i++) {
+            // Branches of different depth to get levels of different width
+            ngraph::Output<ngraph::Node> branch = params[0];
+            for (size_t j = 0; j <= i; j++) {
+                auto conv = ngraph::builder::makeConvolution(branch, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                             ngraph::op::PadType::EXPLICIT, numOutChannels, true);
+                branch = ngraph::builder::makeActivation(conv, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+            }
+            branches.push_back(branch);
+        }
+
+        auto concat = ngraph::builder::makeConcat(branches, 1);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "ParallelBranches");
+    }
+};
+
+namespace  {
+/* Test concurrent execution of independent branches.
+
+                 Parameter
+          /          |          \
+    Conv+Relu    Conv+Relu    Conv+Relu
+        |            |            |
+        |        Conv+Relu    Conv+Relu
+        |            |            |
+        |            |        Conv+Relu
+          \          |          /
+                  Concat
+                     |
+                   Output
+*/
+
+TEST_F(ParallelBranchesTest, smoke_ParallelBranches_CPU) {
+    BuildGraph(3);
+    Run();
+}
+
+/* Sequential chain of nodes must be executed in the regular way */
+TEST_F(ParallelBranchesTest, smoke_ParallelBranchesSingleBranch_CPU) {
+    BuildGraph(1);
+    Run();
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class ShapeCacheTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 4, 8}});
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4, 1}, {2.f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(params[0], scale);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        // Reshape to the input shape produces a constant which depends on the input shape after constant folding
+        auto shapeOf = std::make_shared<ngraph::opset1::ShapeOf>(params[0]);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(relu, shapeOf, false);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(reshape)};
+        function = std::make_shared<ngraph::Function>(results, params, "ShapeCache");
+    }
+
+    void SetInput(InferRequest& request, size_t length) {
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        auto input = make_shared_blob<float>({Precision::FP32, {1, 4, length}, Layout::CHW});
+        input->allocate();
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = static_cast<float>(i % 7) - 3.f;
+        request.SetBlob(inputName, input);
+    }
+
+    void CheckOutput(InferRequest& request, size_t length, size_t expectedLength) {
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto& outputName = executableNetwork.GetOutputsInfo().begin()->first;
+        auto inputData = request.GetBlob(inputName)->cbuffer().as<const float*>();
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ((SizeVector{1, 4, expectedLength}), output->getTensorDesc().getDims());
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t c = 0; c < 4; c++) {
+            for (size_t i = 0; i < expectedLength; i++) {
+                const float expected = i < length ? std::max(0.f, 2.f * inputData[c * length + i]) : 0.f;
+                ASSERT_EQ(expected, outputData[c * expectedLength + i]);
+            }
+        }
+    }
+
+    void InferAndCheck(InferRequest& request, size_t length, size_t expectedLength) {
+        SetInput(request, length);
+        request.Infer();
+        CheckOutput(request, length, expectedLength);
+    }
+};
+
+namespace {
+
+TEST_F(ShapeCacheTest, smoke_ShapeCache_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE] = "2";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+
+    // Repeated shapes are taken from the cache, the third one evicts the least recently used graph
+    for (size_t length : {8, 5, 12, 5, 8, 3, 12}) {
+        InferAndCheck(request, length, length);
+    }
+}
+
+TEST_F(ShapeCacheTest, smoke_ShapeCacheKeepsOutputBlobs_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE] = "2";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+    const auto& outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    // Alternating cached shapes reuse the output blobs allocated for them
+    InferAndCheck(request, 5, 5);
+    auto output5 = request.GetBlob(outputName)->cbuffer().as<const float*>();
+    InferAndCheck(request, 8, 8);
+    auto output8 = request.GetBlob(outputName)->cbuffer().as<const float*>();
+    InferAndCheck(request, 5, 5);
+    ASSERT_EQ(output5, request.GetBlob(outputName)->cbuffer().as<const float*>());
+    InferAndCheck(request, 8, 8);
+    ASSERT_EQ(output8, request.GetBlob(outputName)->cbuffer().as<const float*>());
+}
+
+TEST_F(ShapeCacheTest, smoke_ShapeCacheStreams_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE] = "2";
+    configuration[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+
+    // The network transformed for a shape is shared by the graphs of both streams
+    std::vector<InferRequest> requests{executableNetwork.CreateInferRequest(), executableNetwork.CreateInferRequest()};
+    for (size_t length : {5, 12, 5}) {
+        for (auto& request : requests) {
+            SetInput(request, length);
+            request.StartAsync();
+        }
+        for (auto& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+            CheckOutput(request, length, length);
+        }
+    }
+}
+
+TEST_F(ShapeCacheTest, smoke_ShapeCacheBuckets_CPU) {
+    BuildGraph();
+    configuration[CPUConfigParams::KEY_CPU_SHAPE_CACHE_SIZE] = "2";
+    configuration[CPUConfigParams::KEY_CPU_SHAPE_BUCKETS] = "16,32";
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+
+    InferAndCheck(request, 8, 8);
+    InferAndCheck(request, 5, 16);
+    InferAndCheck(request, 20, 32);
+    InferAndCheck(request, 40, 40);
+}
+
+TEST_F(ShapeCacheTest, smoke_ShapeCacheDisabled_CPU) {
+    BuildGraph();
+    executableNetwork = core->LoadNetwork(CNNNetwork{function}, targetDevice, configuration);
+    auto request = executableNetwork.CreateInferRequest();
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 4, 5}, Layout::CHW});
+    input->allocate();
+    ASSERT_THROW(request.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input), Exception);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class SnippetsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph(const std::vector<size_t>& shape0, const std::vector<size_t>& shape1) {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_SNIPPETS] = PluginConfigParams::YES;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {shape0, shape1});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.5f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(relu, params[1]);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(subtract)};
+        function = std::make_shared<ngraph::Function>(results, params, "Snippets");
+    }
+
+    void BuildUnsupportedGraph(const std::vector<size_t>& shape) {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_SNIPPETS] = PluginConfigParams::YES;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {shape, shape});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto erf = std::make_shared<ngraph::opset1::Erf>(add);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(erf, params[1]);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "UnsupportedSnippets");
+    }
+};
+
+namespace {
+/* Elementwise chain is collapsed to one Subgraph node executed by a generated kernel.
+
+    Parameter   Parameter
+          \       /    |
+            Add        |
+             |         |
+    Multiply(scalar)   |
+             |         |
+           Relu        |
+             \         /
+              Subtract
+                 |
+               Output
+*/
+
+TEST_F(SnippetsTest, smoke_Snippets_CPU) {
+    // the innermost dimension has a tail which is processed by the scalar tile
+    BuildGraph({1, 3, 10, 19}, {1, 3, 10, 19});
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+TEST_F(SnippetsTest, smoke_SnippetsInnermostBroadcast_CPU) {
+    BuildGraph({2, 3, 16, 35}, {2, 3, 16, 1});
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+TEST_F(SnippetsTest, smoke_SnippetsOuterBroadcast_CPU) {
+    BuildGraph({2, 3, 16, 35}, {1, 3, 1, 35});
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+/* There is no emitter for Erf, so the collapsed chain is unfolded back to the operations executed by their own nodes */
+TEST_F(SnippetsTest, smoke_SnippetsUnsupportedAreUnfolded_CPU) {
+    BuildUnsupportedGraph({1, 3, 10, 19});
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Subgraph", 0);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
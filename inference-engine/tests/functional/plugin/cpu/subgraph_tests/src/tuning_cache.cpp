@@ -0,0 +1,156 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class TuningCacheTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph() {
+        InferenceEngine::Precision netPrecision = inPrc = outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+        auto conv1x1 = ngraph::builder::makeConvolution(params[0], ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, 32, true);
+        auto conv3x3 = ngraph::builder::makeConvolution(conv1x1, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, 16, true);
+        auto relu = ngraph::builder::makeActivation(conv3x3, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "TuningCache");
+    }
+
+    void SetUp() override {
+        // the directory is unique, so the tests may run in parallel
+        std::stringstream dir;
+        dir << "cpu_tuning_cache_test_" << std::this_thread::get_id() << "_"
+            << std::chrono::steady_clock::now().time_since_epoch().count();
+        tuningDir = dir.str();
+        CommonTestUtils::createDirectory(tuningDir);
+        tuningFile = CommonTestUtils::makePath(tuningDir, "tuning.txt");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(tuningFile);
+        CommonTestUtils::removeDir(tuningDir);
+    }
+
+    std::vector<std::string> ReadDecisions() const {
+        std::ifstream file(tuningFile);
+        std::vector<std::string> decisions;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (!line.empty())
+                decisions.push_back(line);
+        }
+        return decisions;
+    }
+
+    // Each line is "<isa> <index> <signature>", where the signature ends with a "|<implementation>/<inputs>-/<outputs>"
+    // section per candidate. Switches the convolutions to a candidate with other output layouts than the stored one
+    void ChangeConvolutionDecisions() const {
+        const auto decisions = ReadDecisions();
+        std::ofstream file(tuningFile, std::ios::out | std::ios::trunc);
+        for (auto& decision : decisions) {
+            std::istringstream stream(decision);
+            std::string isa, signature;
+            size_t index;
+            stream >> isa >> index >> signature;
+            if (signature.find("Convolution") == 0) {
+                std::vector<std::string> outputs;
+                for (size_t pos = signature.find('|'); pos != std::string::npos; pos = signature.find('|', pos + 1)) {
+                    const auto candidate = signature.substr(pos, signature.find('|', pos + 1) - pos);
+                    outputs.push_back(candidate.substr(candidate.rfind('-')));
+                }
+                ASSERT_LT(index, outputs.size());
+                for (size_t i = 0; i < outputs.size(); i++) {
+                    if (outputs[i] != outputs[index]) {
+                        index = i;
+                        break;
+                    }
+                }
+            }
+            file << isa << " " << index << " " << signature << "\n";
+        }
+    }
+
+    std::vector<std::string> GetConvolutionLayouts() {
+        std::vector<std::string> layouts;
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) {
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(rtInfo.at(paramName));
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "Convolution")
+                layouts.push_back(getExecValue(ExecGraphInfoSerialization::OUTPUT_LAYOUTS));
+        }
+        return layouts;
+    }
+
+    std::string tuningDir;
+    std::string tuningFile;
+};
+
+namespace {
+
+TEST_F(TuningCacheTest, smoke_TuningCache_CPU) {
+    BuildGraph();
+
+    // the decisions are measured and saved on the first load
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_CREATE;
+    configuration[PluginConfigParams::KEY_TUNING_FILE] = tuningFile;
+    Run();
+    const auto decisions = ReadDecisions();
+    ASSERT_FALSE(decisions.empty());
+    const auto tunedLayouts = GetConvolutionLayouts();
+    ASSERT_EQ(2, tunedLayouts.size());
+
+    // and reused by the next one without tuning again
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_USE_EXISTING;
+    Run();
+    ASSERT_EQ(decisions, ReadDecisions());
+    ASSERT_EQ(tunedLayouts, GetConvolutionLayouts());
+}
+
+TEST_F(TuningCacheTest, smoke_TuningCacheAppliesStoredDecisions_CPU) {
+    BuildGraph();
+
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_CREATE;
+    configuration[PluginConfigParams::KEY_TUNING_FILE] = tuningFile;
+    Run();
+    const auto tunedLayouts = GetConvolutionLayouts();
+    ASSERT_EQ(2, tunedLayouts.size());
+
+    // the convolutions get the descriptors read from the file rather than the measured ones
+    ChangeConvolutionDecisions();
+    const auto decisions = ReadDecisions();
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_USE_EXISTING;
+    Run();
+    ASSERT_EQ(decisions, ReadDecisions());
+    const auto storedLayouts = GetConvolutionLayouts();
+    ASSERT_EQ(2, storedLayouts.size());
+    for (size_t i = 0; i < tunedLayouts.size(); i++)
+        ASSERT_NE(tunedLayouts[i], storedLayouts[i]);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
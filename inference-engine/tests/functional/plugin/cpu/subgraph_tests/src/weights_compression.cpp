@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class WeightsCompressionTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph(const ngraph::element::Type& weightsType, bool transposeB, bool int4 = false, size_t outChannels = 32) {
+        const size_t batch = 2, inChannels = 64;
+
+        InferenceEngine::Precision netPrecision = inPrc = outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION] = PluginConfigParams::YES;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {{batch, inChannels}});
+
+        const auto weightsShape = transposeB ? ngraph::Shape{outChannels, inChannels} : ngraph::Shape{inChannels, outChannels};
+        const auto channelShape = transposeB ? ngraph::Shape{outChannels, 1} : ngraph::Shape{1, outChannels};
+        // the whole 8-bit (or 4-bit) range is used, so the kernel sees both the lowest and the highest levels
+        std::vector<int> weightsData(ngraph::shape_size(weightsShape));
+        const int levels = int4 ? 16 : 256;
+        const int lowest = weightsType == ngraph::element::i8 ? -levels / 2 : 0;
+        for (size_t i = 0; i < weightsData.size(); i++)
+            weightsData[i] = lowest + static_cast<int>((i * 37) % levels);
+        std::vector<float> zeroPoints(outChannels), scales(outChannels);
+        for (size_t i = 0; i < outChannels; i++) {
+            zeroPoints[i] = static_cast<float>(lowest + static_cast<int>((i * 11) % levels));
+            scales[i] = 0.01f * static_cast<float>(i % 5 + 1);
+        }
+
+        auto weights = ngraph::opset1::Constant::create(weightsType, weightsShape, weightsData);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngPrc);
+        auto zeroPoint = ngraph::opset1::Constant::create(ngPrc, channelShape, zeroPoints);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zeroPoint);
+        auto scale = ngraph::opset1::Constant::create(ngPrc, channelShape, scales);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], multiply, false, transposeB);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matMul)};
+        function = std::make_shared<ngraph::Function>(results, params, "WeightsCompression");
+    }
+
+    void CheckRuntimePrecision(const std::string& nodeType, Precision expectedPrecision) {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == nodeType)
+                ASSERT_EQ(expectedPrecision.name(), getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION))
+                    << node->get_friendly_name();
+        }
+    }
+};
+
+namespace  {
+/* The dequantization subgraph of the weights is folded into the FullyConnected node, which reads
+   the 8-bit weights as they are and applies the per output channel scale and shift in the kernel.
+
+    Parameter[FP32]     Constant[U8/I8]
+          \                 |
+           \           Convert[FP32]
+            \               |
+             \      Subtract(zero point)
+              \             |
+               \    Multiply(scale)
+                \          /
+                 MatMul[FP32]
+                      |
+                 Output[FP32]
+*/
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionU8_CPU) {
+    BuildGraph(ngraph::element::u8, true);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionI8_CPU) {
+    BuildGraph(ngraph::element::i8, true);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+/* Not transposed weights get a Permute from MatMul to FullyConnected conversion, which is folded as well */
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionNotTransposedU8_CPU) {
+    BuildGraph(ngraph::element::u8, false);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionNotTransposedI8_CPU) {
+    BuildGraph(ngraph::element::i8, false);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+/* The weights which fit in 4 bits are packed by two per byte */
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionInt4U8_CPU) {
+    BuildGraph(ngraph::element::u8, true, true);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionInt4I8_CPU) {
+    BuildGraph(ngraph::element::i8, true, true);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+/* The number of outputs is not a multiple of the block of outputs for any ISA, so the last block is padded */
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionOutputsTailU8_CPU) {
+    BuildGraph(ngraph::element::u8, true, false, 40);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionNotTransposedOutputsTailI8_CPU) {
+    BuildGraph(ngraph::element::i8, false, false, 40);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionInt4OutputsTailI8_CPU) {
+    BuildGraph(ngraph::element::i8, true, true, 40);
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+}
+
+/* The kernel takes FP32 rows only. The compressed weights make the model quantized, which is never converted
+   to BF16, so ENFORCE_BF16 keeps the whole model in FP32 and the weights stay compressed */
+TEST_F(WeightsCompressionTest, smoke_WeightsCompressionEnforceBF16_CPU) {
+    BuildGraph(ngraph::element::u8, true);
+    configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::YES;
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Quantize", 0);
+    CheckRuntimePrecision("FullyConnected", Precision::FP32);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
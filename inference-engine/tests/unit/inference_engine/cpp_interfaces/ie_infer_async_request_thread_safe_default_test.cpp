@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -230,3 +232,80 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, canStartAsyncAgainAfterFailedRequest) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl())
+        .WillOnce(Throw(std::exception()))
+        .WillRepeatedly(Return());
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    for (int i = 0; i < 100; i++) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitForJustStartedRequestReturnsAfterItsCompletion) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+
+    std::atomic<int> inferredCount{0};
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl())
+        .WillRepeatedly(Invoke([&] {inferredCount++;}));
+
+    for (int i = 0; i < 100; i++) {
+        std::thread starter([&] {testRequest->StartAsync();});
+        // Wait right after the request became busy, the run may not be numbered yet
+        void* userData = nullptr;
+        while (inferredCount.load() != i + 1) {
+            try {
+                testRequest->GetUserData(&userData);
+            } catch (const RequestBusy&) {
+                break;
+            }
+        }
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_EQ(i + 1, inferredCount.load());
+        starter.join();
+    }
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitDoesNotThrowExceptionOfLaterRun) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase(testRequest));
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl())
+        .WillOnce(Return())
+        .WillOnce(Throw(std::exception()));
+
+    // The callback of the first run fails the second one before the first run is completed
+    bool isSecondRunFailed = false;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                try {
+                    testRequest->Infer();
+                } catch (const std::exception&) {
+                    isSecondRunFailed = true;
+                }
+            };
+    cppRequest.SetCompletionCallback(callback);
+
+    testRequest->StartAsync();
+    std::thread executor([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        taskExecutor->executeAll();
+    });
+    // waits for the first run started before
+    EXPECT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    executor.join();
+    ASSERT_TRUE(isSecondRunFailed);
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+}
@@ -10,6 +10,7 @@
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
@@ -349,6 +350,49 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    for (auto& op : net2.getFunction()->get_ops()) {
+        if (op->get_friendly_name() == "mul_constant") {
+            auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {4});
+            constant->set_friendly_name("mul_constant");
+            ngraph::replace_node(op, constant);
+        }
+    }
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto createEluNetwork = [](double alpha) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        data->set_friendly_name("Parameter");
+        auto elu = std::make_shared<ngraph::opset6::Elu>(data, alpha);
+        elu->set_friendly_name("elu");
+        auto res = std::make_shared<ngraph::opset6::Result>(elu);
+        res->set_friendly_name("res");
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    ASSERT_NE(NetworkCompilationContext::computeHash(createEluNetwork(1.0), {}),
+              NetworkCompilationContext::computeHash(createEluNetwork(2.0), {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createEluNetwork(2.0), {}),
+              NetworkCompilationContext::computeHash(createEluNetwork(2.0), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithSharedConstants) {
+    // the second hash of the same buffers is taken from the cache
+    auto net1 = createNetwork();
+    auto net2 = CNNNetwork(ngraph::clone_function(*net1.getFunction()));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
 ////////////////////////////////////////////
 
 TEST(NetworkContext_ModelName, HashOfSame) {
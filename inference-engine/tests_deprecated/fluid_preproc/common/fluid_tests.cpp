@@ -19,6 +19,7 @@
 #include <cstdio>
 #include <ctime>
 
+#include <algorithm>
 #include <chrono>
 
 #include <map>
@@ -1223,3 +1224,62 @@ TEST_P(PreprocTest, Performance)
 #endif // PERF_TEST
 
 }
+
+TEST_P(BatchPreprocTestIE, BatchEqualsItemByItem)
+{
+    using namespace InferenceEngine;
+    ResizeAlgorithm interp = NO_RESIZE;
+    ColorFormat in_fmt = ColorFormat::RAW;
+    Layout out_layout = Layout::ANY;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(interp, in_fmt, out_layout, sizes) = GetParam();
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+
+    const size_t channels = 3;
+    const size_t in_item_size = channels * in_size.area();
+    const size_t out_item_size = channels * out_size.area();
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(interp);
+    info.setColorFormat(in_fmt);
+
+    // the same engine goes through all batch sizes, so the slices are regrouped between the batch items
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+
+    for (size_t batch : {1, 2, 3, 4, 8, 3}) {
+        // batch items are the stacked rows of a single matrix
+        cv::Mat in_mat(in_size.height * static_cast<int>(batch), in_size.width, CV_8UC3);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+        ASSERT_TRUE(in_mat.isContinuous());
+
+        std::vector<uint8_t> out(batch * out_item_size), out_ref(batch * out_item_size);
+
+        TensorDesc in_desc(Precision::U8, {batch, channels, size_t(in_size.height), size_t(in_size.width)},
+                           Layout::NHWC);
+        TensorDesc out_desc(Precision::U8, {batch, channels, size_t(out_size.height), size_t(out_size.width)},
+                            out_layout);
+        Blob::Ptr out_blob = make_shared_blob<uint8_t>(out_desc, out.data());
+
+        preprocess->setRoiBlob(make_shared_blob<uint8_t>(in_desc, in_mat.data));
+        preprocess->execute(out_blob, info, false);
+
+        // each item is pre-processed alone, so all slices split the rows of a single image
+        TensorDesc in_item_desc(Precision::U8, {1, channels, size_t(in_size.height), size_t(in_size.width)},
+                                Layout::NHWC);
+        TensorDesc out_item_desc(Precision::U8, {1, channels, size_t(out_size.height), size_t(out_size.width)},
+                                 out_layout);
+        PreProcessDataPtr preprocess_ref = CreatePreprocDataHelper();
+        for (size_t i = 0; i < batch; i++) {
+            Blob::Ptr out_item_blob = make_shared_blob<uint8_t>(out_item_desc, out_ref.data() + i * out_item_size);
+            preprocess_ref->setRoiBlob(make_shared_blob<uint8_t>(in_item_desc, in_mat.data + i * in_item_size));
+            preprocess_ref->execute(out_item_blob, info, false);
+        }
+
+        for (size_t i = 0; i < batch; i++) {
+            EXPECT_TRUE(std::equal(out_ref.begin() + i * out_item_size, out_ref.begin() + (i + 1) * out_item_size,
+                                   out.begin() + i * out_item_size))
+                << "batch " << batch << ", item " << i;
+        }
+    }
+}
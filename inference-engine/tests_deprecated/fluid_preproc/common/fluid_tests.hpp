@@ -68,4 +68,11 @@ using PreprocParams = std::tuple< std::pair<InferenceEngine::Precision     // in
 
 struct PreprocTest: public TestParams<PreprocParams> {};
 
+struct BatchPreprocTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ResizeAlgorithm,
+                                             InferenceEngine::ColorFormat,  // input color format
+                                             InferenceEngine::Layout,  // output layout
+                                             std::pair<cv::Size, cv::Size>>>  // input and output sizes
+{};
+
 #endif //FLUID_TESTS_HPP
@@ -417,3 +417,9 @@ INSTANTIATE_TEST_CASE_P(PrecisionConversionsPipelines, PreprocTest,
                                 Values(IE::Layout::NHWC, IE::Layout::NCHW),
                                 Values(std::make_pair(1, 1), std::make_pair(3, 3)),
                                 Values(TEST_SIZES_PREPROC)));
+
+INSTANTIATE_TEST_CASE_P(BatchResizeColorConvert, BatchPreprocTestIE,
+                        Combine(Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::ColorFormat::RGB),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                PATCH_SIZES));
@@ -0,0 +1,198 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "../test_graph.hpp"
+#include "mkldnn_exec_network.h"
+
+#include "tests_common.hpp"
+#include <ie_core.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+namespace {
+
+class MKLDNNZeroCopyTestExecNetwork : public MKLDNNPlugin::MKLDNNExecNetwork {
+public:
+    using MKLDNNPlugin::MKLDNNExecNetwork::MKLDNNExecNetwork;
+
+    void* getOutputMemoryPtr(const std::string& name) {
+        auto graphLock = GetGraph();
+        for (auto& output : graphLock._graph.GetOutputNodes()) {
+            if (output->getName() == "out_" + name)
+                return output->getParentEdgeAt(0)->getMemory().GetData();
+        }
+        return nullptr;
+    }
+};
+
+}  // namespace
+
+class MKLDNNGraphOutputZeroCopyTests: public TestsCommon {
+protected:
+    /* The first output is also read by the second pooling, so the graph has to write it to the user blob
+       and read it back from there.
+
+            data
+              |
+            pool1
+            /    \
+        Output  pool2
+                  |
+                Output
+    */
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="1">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="1" stride-y="1" rounding-type="floor" pool-method="max"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool2" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="1" stride-y="1" rounding-type="floor" pool-method="max"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    MKLDNNPlugin::NumaNodesWeights cache;
+
+    std::shared_ptr<MKLDNNZeroCopyTestExecNetwork> createExecNetwork(InferenceEngine::CNNNetwork& network,
+                                                                     const MKLDNNPlugin::Config& config,
+                                                                     InferenceEngine::Precision outputPrecision) {
+        network.addOutput("pool1");
+        for (auto& output : network.getOutputsInfo())
+            output.second->setPrecision(outputPrecision);
+        auto execNetwork = std::make_shared<MKLDNNZeroCopyTestExecNetwork>(network, config, nullptr, cache);
+        execNetwork->setNetworkInputs(network.getInputsInfo());
+        execNetwork->setNetworkOutputs(network.getOutputsInfo());
+        return execNetwork;
+    }
+
+    void infer(InferenceEngine::IInferRequest::Ptr& inferRequest) {
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::Blob::Ptr src;
+        InferenceEngine::StatusCode sts = inferRequest->GetBlob("data", src, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        fill_data(src->buffer(), src->size());
+
+        sts = inferRequest->Infer(&resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    }
+};
+
+TEST_F(MKLDNNGraphOutputZeroCopyTests, TestOutputBlobsAreGraphMemory) {
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+    auto execNetwork = createExecNetwork(network, {}, InferenceEngine::Precision::FP32);
+    InferenceEngine::IInferRequest::Ptr inferRequest = execNetwork->CreateInferRequest();
+
+    // the blob of pool2 is set by user, the blob of pool1 is allocated by the request
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::Blob::Ptr userOutput = InferenceEngine::make_shared_blob<float>(
+            network.getOutputsInfo()["pool2"]->getTensorDesc());
+    userOutput->allocate();
+    InferenceEngine::StatusCode sts = inferRequest->SetBlob("pool2", userOutput, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    infer(inferRequest);
+
+    for (const auto& name : {"pool1", "pool2"}) {
+        InferenceEngine::Blob::Ptr output;
+        sts = inferRequest->GetBlob(name, output, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        ASSERT_EQ(output->buffer().as<void*>(), execNetwork->getOutputMemoryPtr(name)) << name;
+    }
+}
+
+/* The conversion to I32 is a Reorder node of the graph, which writes to the user blob as well */
+TEST_F(MKLDNNGraphOutputZeroCopyTests, TestConvertedOutputBlobsAreGraphMemory) {
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+    auto execNetwork = createExecNetwork(network, {}, InferenceEngine::Precision::I32);
+    InferenceEngine::IInferRequest::Ptr inferRequest = execNetwork->CreateInferRequest();
+
+    infer(inferRequest);
+
+    InferenceEngine::ResponseDesc resp;
+    for (const auto& name : {"pool1", "pool2"}) {
+        InferenceEngine::Blob::Ptr output;
+        InferenceEngine::StatusCode sts = inferRequest->GetBlob(name, output, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        ASSERT_EQ(InferenceEngine::Precision::I32, output->getTensorDesc().getPrecision()) << name;
+        ASSERT_EQ(output->buffer().as<void*>(), execNetwork->getOutputMemoryPtr(name)) << name;
+    }
+}
+
+/* Only a part of the batch may be processed with the dynamic batch, so the outputs are copied from the graph memory */
+TEST_F(MKLDNNGraphOutputZeroCopyTests, TestOutputBlobsAreCopiedWithDynamicBatch) {
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED,
+                            InferenceEngine::PluginConfigParams::YES}});
+    config.batchLimit = static_cast<int>(network.getBatchSize());
+    auto execNetwork = createExecNetwork(network, config, InferenceEngine::Precision::FP32);
+    InferenceEngine::IInferRequest::Ptr inferRequest = execNetwork->CreateInferRequest();
+
+    infer(inferRequest);
+
+    InferenceEngine::ResponseDesc resp;
+    for (const auto& name : {"pool1", "pool2"}) {
+        InferenceEngine::Blob::Ptr output;
+        InferenceEngine::StatusCode sts = inferRequest->GetBlob(name, output, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        ASSERT_NE(nullptr, execNetwork->getOutputMemoryPtr(name)) << name;
+        ASSERT_NE(output->buffer().as<void*>(), execNetwork->getOutputMemoryPtr(name)) << name;
+    }
+}
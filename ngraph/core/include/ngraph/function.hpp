@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,10 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the operations of the function in topological order. The order is
+        ///        cached and recomputed only if the parameters, results or sinks of the function
+        ///        or the topology of its nodes have changed since the last call, see
+        ///        Node::get_topology_version().
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -210,6 +215,15 @@ namespace ngraph
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // incremented on changes of the parameters, results, sinks and the sorter
+        size_t m_topology_version{0};
+        // the order is kept by weak references to not prolong lifetime of the removed nodes,
+        // along with the topology versions of the nodes at the moment of sorting
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::pair<std::weak_ptr<Node>, size_t>> m_cached_ordered_ops;
+        mutable bool m_ordered_ops_cached{false};
+        mutable size_t m_ordered_ops_version{0};
+
         ResultVector m_results;
 
         // List of the nodes with side effect in graph.
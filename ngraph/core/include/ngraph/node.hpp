@@ -264,6 +264,10 @@ namespace ngraph
 
         virtual bool is_dynamic() const;
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns the version of the node's inputs and control dependencies. The version
+        ///        is incremented every time one of them changes, so a cached traversal of a graph
+        ///        stays valid as long as the versions of all the traversed nodes are the same.
+        size_t get_topology_version() const { return m_topology_version; }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -480,6 +484,7 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        void increment_topology_version() { ++m_topology_version; }
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
@@ -488,6 +493,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        size_t m_topology_version{0};
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <unordered_set>
+
+#include "ngraph/pass/parallel_executor.hpp"
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -26,19 +29,51 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        Only nodes which consume replaced outputs are re-validated. Independent nodes
+         *        with constant inputs are evaluated with the executor if it is set.
+         *        Set NGRAPH_PROFILE_PASS_ENABLE to print the time spent and bytes folded.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+            /// \param executor Evaluates independent constant sub-expressions concurrently, they
+            /// are evaluated sequentially if it is empty
+            explicit ConstantFolding(const parallel_executor& executor = nullptr)
+                : m_executor(executor)
+            {
+            }
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
+            struct Statistics
+            {
+                size_t folded_nodes = 0;
+                size_t folded_bytes = 0;
+            };
+            using NodeSet = std::unordered_set<const Node*>;
+
+            bool fold_function(const std::shared_ptr<ngraph::Function>& f, Statistics& stats);
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements,
+                                 NodeSet& revalidate,
+                                 Statistics& stats);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
-            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f,
+                                               NodeSet& revalidate,
+                                               Statistics& stats);
+            /// \brief Evaluates nodes with constant inputs wave by wave. Nodes of the same wave
+            /// don't depend on each other and are evaluated concurrently, replacements are
+            /// applied sequentially.
+            bool parallel_values_folding(const std::shared_ptr<ngraph::Function>& f,
+                                         NodeSet& revalidate,
+                                         Statistics& stats);
+
+            parallel_executor m_executor;
         };
     } // namespace pass
 } // namespace ngraph
@@ -20,6 +20,7 @@
 #include <memory>
 #include <set>
 
+#include "ngraph/pass/parallel_executor.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
 
@@ -127,6 +128,15 @@ namespace ngraph
         /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher
         /// passes more
         /// efficient.
+        /// GraphRewrite with parallel matching enabled (\sa GraphRewrite::set_parallel_matching)
+        /// matches type based root patterns of big functions in parallel before the rewrites:
+        /// every chunk of the initial nodes is matched by its own copy of the Matchers.
+        /// Callbacks are still called sequentially in topological order, and a matcher pass is
+        /// skipped for a node only if its pattern didn't match the node and none of the nodes the
+        /// pattern may reach has been changed since then. Pattern predicates must be thread safe
+        /// and must not modify the graph for this to be correct.
+        /// Set NGRAPH_PROFILE_PASS_ENABLE to print how many times every matcher pass was tried,
+        /// skipped thanks to the parallel matching and applied.
 
         class NGRAPH_API GraphRewrite : public ngraph::pass::FunctionPass
         {
@@ -230,8 +240,17 @@ namespace ngraph
 
             void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+            /// \brief Enables matching of the initial nodes on the threads of the executor, an
+            /// empty executor disables it. Disabled by default, should be enabled only if
+            /// predicates of all the registered patterns are thread safe.
+            void set_parallel_matching(const parallel_executor& executor)
+            {
+                m_parallel_executor = executor;
+            }
+
         protected:
             bool m_enable_shape_inference = false;
+            parallel_executor m_parallel_executor;
 
             std::vector<std::shared_ptr<ngraph::pass::MatcherPass>> m_matchers;
         };
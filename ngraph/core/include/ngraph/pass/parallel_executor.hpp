@@ -0,0 +1,36 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Runs func(i) for every i in [0, count) and returns when all the calls are done.
+        ///
+        /// nGraph core has no threading runtime of its own, so the passes which are able to
+        /// process independent items in parallel take an executor from the caller. A plugin
+        /// passes one running the calls on its TBB / OpenMP workers, e.g. with
+        /// InferenceEngine::parallel_for, so the passes share the threads and the limits of the
+        /// plugin. An empty executor makes the passes sequential.
+        using parallel_executor =
+            std::function<void(size_t count, const std::function<void(size_t)>& func)>;
+    } // namespace pass
+} // namespace ngraph
@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Memory which holds the content of a mapped file
+        class NGRAPH_API MappedMemory
+        {
+        public:
+            virtual ~MappedMemory() = default;
+            virtual char* data() noexcept = 0;
+            virtual size_t size() const noexcept = 0;
+        };
+
+        /// \brief      Maps the whole file to memory. Pages are read on the first access and are
+        ///             shared with other processes which map the same file. The mapping is
+        ///             private, so written pages are copied and the file is never modified.
+        ///
+        /// \param      path  Path to the file
+        ///
+        /// \return     Mapped memory which is valid while the object exists. The data is nullptr
+        ///             for an empty file.
+        ///
+        /// \throws     ngraph_error if the file can't be opened or mapped
+        NGRAPH_API
+        std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        /// \brief      Maps the whole file to memory
+        ///
+        /// \param      path  Path to the file
+        ///
+        /// \return     Mapped memory which is valid while the object exists
+        NGRAPH_API
+        std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif
+    }
+}
@@ -45,7 +45,12 @@ descriptor::Input::Input(Node* node, size_t index)
 
 descriptor::Input::~Input()
 {
-    remove_output();
+    // the node being destroyed is unreachable from any graph root, so unlinking it doesn't
+    // change the topology
+    if (m_output != nullptr)
+    {
+        m_output->remove_input(this);
+    }
 }
 
 void descriptor::Input::replace_output(Output& new_output)
@@ -57,6 +62,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->increment_topology_version();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -79,6 +85,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        m_node->increment_topology_version();
     }
 }
 
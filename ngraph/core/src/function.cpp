@@ -159,6 +159,28 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    if (m_ordered_ops_cached && m_ordered_ops_version == m_topology_version)
+    {
+        // the order is still valid if none of the ordered nodes has changed its inputs or
+        // control dependencies, as only they are traversed by the sort
+        vector<shared_ptr<Node>> order;
+        order.reserve(m_cached_ordered_ops.size());
+        for (const auto& cached_node : m_cached_ordered_ops)
+        {
+            auto node = cached_node.first.lock();
+            if (!node || node->get_topology_version() != cached_node.second)
+            {
+                break;
+            }
+            order.push_back(std::move(node));
+        }
+        if (order.size() == m_cached_ordered_ops.size())
+        {
+            return order;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -173,7 +195,16 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto order = m_topological_sorter(nodes);
+    m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(order.size());
+    for (const auto& node : order)
+    {
+        m_cached_ordered_ops.emplace_back(node, node->get_topology_version());
+    }
+    m_ordered_ops_version = m_topology_version;
+    m_ordered_ops_cached = true;
+    return order;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -337,11 +368,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    ++m_topology_version;
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    ++m_topology_version;
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -411,12 +444,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    ++m_topology_version;
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    ++m_topology_version;
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -425,11 +460,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    ++m_topology_version;
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    ++m_topology_version;
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -439,6 +476,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    ++m_topology_version;
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -455,6 +493,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    ++m_topology_version;
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -464,6 +503,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    ++m_topology_version;
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
@@ -65,6 +65,7 @@ Node& Node::operator=(const Node& node)
     this->m_provenance_tags = node.m_provenance_tags;
     this->m_provenance_group = node.m_provenance_group;
     this->m_inputs = node.m_inputs;
+    increment_topology_version();
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
     // cannot do it without copying node.m_inputs first due to too limiting const qualifiers
@@ -194,6 +195,8 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    increment_topology_version();
+
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -485,6 +488,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        increment_topology_version();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -522,6 +526,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            increment_topology_version();
         }
     }
     {
@@ -543,7 +548,11 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
-    m_control_dependencies.clear();
+    if (!m_control_dependencies.empty())
+    {
+        m_control_dependencies.clear();
+        increment_topology_version();
+    }
 }
 
 void Node::clear_control_dependents()
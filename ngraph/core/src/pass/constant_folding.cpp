@@ -15,24 +15,122 @@
 //*****************************************************************************
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include "ngraph/env_util.hpp"
+#include "ngraph/op/convert_like.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sink.hpp"
+#include "ngraph/op/squeeze.hpp"
+#include "ngraph/op/unsqueeze.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/util.hpp"
+#include "parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Waves with less input data are evaluated in the calling thread, scheduling them on the
+    // executor costs more than the evaluation itself
+    const size_t parallel_folding_min_bytes = 1 << 16;
+
+    size_t get_byte_size(const op::Constant* constant)
+    {
+        return (shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) /
+               8;
+    }
+
+    void revalidate_node(const shared_ptr<Node>& node, unordered_set<const Node*>& revalidate)
+    {
+        vector<pair<element::Type, PartialShape>> outputs_before;
+        for (const auto& output : node->outputs())
+        {
+            outputs_before.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+
+        node->validate_and_infer_types();
+
+        // Consumers have to be validated again only if the node outputs were changed
+        for (size_t i = 0; i < node->get_output_size(); ++i)
+        {
+            if (i >= outputs_before.size() ||
+                outputs_before[i].first != node->get_output_element_type(i) ||
+                outputs_before[i].second != node->get_output_partial_shape(i))
+            {
+                for (const auto& input : node->output(i).get_target_inputs())
+                {
+                    revalidate.insert(input.get_node());
+                }
+            }
+        }
+    }
+
+    // Nodes which can be evaluated independently from the rest of the graph. Reshape-like
+    // operations are left for the sequential pass which folds them without copying the data.
+    // ConvertLike folding connects a temporary Convert to the input, i.e. modifies the graph.
+    bool is_evaluable(const Node* node)
+    {
+        if (node->get_input_size() == 0 || is_type<op::Constant>(node) ||
+            is_type<op::Result>(node) || dynamic_cast<const op::Sink*>(node) ||
+            dynamic_cast<const op::util::SubGraphOp*>(node) || is_type<op::v1::Reshape>(node) ||
+            is_type<op::v0::Squeeze>(node) || is_type<op::v0::Unsqueeze>(node) ||
+            is_type<op::v1::ConvertLike>(node) ||
+            node->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
+        {
+            return false;
+        }
+        for (const auto& input : node->inputs())
+        {
+            if (!is_type<op::Constant>(input.get_source_output().get_node()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    static const bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
+    stopwatch timer;
+    timer.start();
+    Statistics stats;
+    bool rewritten = fold_function(f, stats);
+    timer.stop();
+
+    if (profile_enabled)
+    {
+        cout << setw(7) << timer.get_milliseconds() << "ms " << get_name() << " folded "
+             << stats.folded_nodes << " nodes into " << stats.folded_bytes << " bytes\n";
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::fold_function(const std::shared_ptr<ngraph::Function>& f,
+                                                  Statistics& stats)
+{
+    NodeSet revalidate;
+    bool rewritten = pre_calculated_values_folding(f, revalidate, stats);
+    if (m_executor)
+    {
+        rewritten |= parallel_values_folding(f, revalidate, stats);
+    }
 
     for (const auto& node : f->get_ordered_ops())
     {
-        if (rewritten)
+        if (revalidate.count(node.get()))
         {
-            node->validate_and_infer_types();
+            revalidate_node(node, revalidate);
         }
 
         OutputVector replacements(node->get_output_size());
@@ -42,43 +140,159 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
                          "constant_fold_default returned incorrect number of replacements for ",
                          node);
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+            rewritten |= replace_outputs(node, replacements, revalidate, stats);
+        }
+        else
+        {
+            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                if (const auto& sub_graph = sub_graph_node->get_function())
                 {
-                    if (replacements.size() == 1)
+                    if (fold_function(sub_graph, stats))
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
+                        revalidate_node(node, revalidate);
+                        rewritten = true;
                     }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
                 }
             }
         }
-        else
+    }
+
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements,
+                                                    NodeSet& revalidate,
+                                                    Statistics& stats)
+{
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
         {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (replacements.size() == 1)
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            for (const auto& input : replacement.get_target_inputs())
+            {
+                revalidate.insert(input.get_node());
+            }
+            if (auto constant = as_type_ptr<op::Constant>(replacement.get_node_shared_ptr()))
+            {
+                stats.folded_bytes += get_byte_size(constant.get());
+            }
+            rewritten = true;
+        }
+    }
+    if (rewritten)
+    {
+        stats.folded_nodes++;
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::parallel_values_folding(
+    const std::shared_ptr<ngraph::Function>& f, NodeSet& revalidate, Statistics& stats)
+{
+    const auto ordered_ops = f->get_ordered_ops();
+    unordered_map<const Node*, size_t> topological_index;
+    vector<shared_ptr<Node>> wave;
+    for (size_t i = 0; i < ordered_ops.size(); ++i)
+    {
+        topological_index[ordered_ops[i].get()] = i;
+        if (is_evaluable(ordered_ops[i].get()))
+        {
+            wave.push_back(ordered_ops[i]);
+        }
+    }
+
+    bool rewritten = false;
+    while (!wave.empty())
+    {
+        size_t input_bytes = 0;
+        for (const auto& node : wave)
+        {
+            if (revalidate.count(node.get()))
+            {
+                revalidate_node(node, revalidate);
+            }
+            for (const auto& input : node->input_values())
+            {
+                input_bytes += get_byte_size(static_cast<op::Constant*>(input.get_node()));
+            }
+        }
+
+        // Folding of the evaluable nodes reads the input constants and creates new ones, but
+        // doesn't modify the graph. Names are generated on the first request, so they are
+        // generated before the nodes are shared with the executor.
+        for (const auto& node : wave)
+        {
+            node->get_name();
+        }
+        vector<OutputVector> replacements(wave.size());
+        vector<char> folded(wave.size(), false);
+        const parallel_executor no_executor;
+        const auto& executor =
+            input_bytes >= parallel_folding_min_bytes ? m_executor : no_executor;
+        internal::run_parallel(executor, wave.size(), [&](size_t i) {
+            replacements[i].resize(wave[i]->get_output_size());
+            folded[i] = wave[i]->constant_fold(replacements[i], wave[i]->input_values());
+        });
+
+        vector<shared_ptr<Node>> next_wave;
+        for (size_t i = 0; i < wave.size(); ++i)
+        {
+            if (!folded[i])
+            {
+                continue;
+            }
+            NGRAPH_CHECK(replacements[i].size() == wave[i]->get_output_size(),
+                         "constant_fold_default returned incorrect number of replacements for ",
+                         wave[i]);
+            if (!replace_outputs(wave[i], replacements[i], revalidate, stats))
+            {
+                continue;
+            }
+            rewritten = true;
+            for (const auto& replacement : replacements[i])
+            {
+                for (const auto& input : replacement.get_target_inputs())
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    if (is_evaluable(input.get_node()))
+                    {
+                        next_wave.push_back(input.get_node()->shared_from_this());
+                    }
                 }
             }
         }
-    }
 
+        // Keep the topological order so replacements are applied the same way as sequentially
+        auto get_index = [&](const shared_ptr<Node>& node) {
+            auto it = topological_index.find(node.get());
+            return it != topological_index.end() ? it->second : ordered_ops.size();
+        };
+        sort(next_wave.begin(),
+             next_wave.end(),
+             [&](const shared_ptr<Node>& lhs, const shared_ptr<Node>& rhs) {
+                 return get_index(lhs) < get_index(rhs);
+             });
+        next_wave.erase(unique(next_wave.begin(), next_wave.end()), next_wave.end());
+        wave = move(next_wave);
+    }
     return rewritten;
 }
 
@@ -93,7 +307,7 @@ void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
 }
 
 bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
-    const std::shared_ptr<ngraph::Function>& f)
+    const std::shared_ptr<ngraph::Function>& f, NodeSet& revalidate, Statistics& stats)
 {
     deque<shared_ptr<Node>> nodes;
     set<shared_ptr<Node>> visited;
@@ -133,6 +347,12 @@ bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(input_node, replacement);
 
+                    for (const auto& input : replacement->output(0).get_target_inputs())
+                    {
+                        revalidate.insert(input.get_node());
+                    }
+                    stats.folded_nodes++;
+                    stats.folded_bytes += get_byte_size(replacement.get());
                     rewritten = true;
                 }
             }
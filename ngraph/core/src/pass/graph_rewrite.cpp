@@ -16,9 +16,14 @@
 
 #include <algorithm>
 #include <deque>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <ngraph/pattern/op/branch.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
+#include <set>
+#include <typeinfo>
 #include <unordered_set>
 #include <vector>
 
@@ -27,6 +32,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -67,19 +73,117 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::GraphRewrite, "ngraph::pass::GraphRewrite",
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MatcherPass, "ngraph::pass::MatcherPass", 0);
 
+namespace
+{
+    // Patterns are matched on the executor only if there are at least this many pairs of a node
+    // and a matcher to check, otherwise scheduling the chunks costs more than the matching itself
+    const size_t parallel_matching_min_pairs = 1 << 12;
+    // The initial nodes are split into this many chunks at most, so the executor is able to
+    // balance the load whatever number of threads it has
+    const size_t parallel_matching_max_chunks = 64;
+    const size_t unlimited_depth = numeric_limits<size_t>::max();
+
+    struct MatcherStatistics
+    {
+        size_t tried = 0;
+        size_t skipped = 0;
+        size_t matched_in_parallel = 0;
+        size_t applied = 0;
+    };
+
+    // State of a node which results of the parallel matching rely on
+    struct NodeSnapshot
+    {
+        OutputVector inputs;
+        vector<set<Input<Node>>> consumers;
+        vector<pair<element::Type, PartialShape>> outputs;
+        Node::RTMap rt_info;
+    };
+
+    void take_snapshot(const Node* node, NodeSnapshot& snapshot)
+    {
+        snapshot.inputs = node->input_values();
+        for (const auto& output : node->outputs())
+        {
+            snapshot.consumers.push_back(output.get_target_inputs());
+            snapshot.outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+        snapshot.rt_info = node->get_rt_info();
+    }
+
+    bool is_snapshot_actual(const NodeSnapshot& snapshot, const Node* node)
+    {
+        // rt_info attributes are immutable and replaced as a whole, so the pointers are compared
+        if (snapshot.inputs != node->input_values() ||
+            snapshot.outputs.size() != node->get_output_size() ||
+            snapshot.rt_info != node->get_rt_info())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < snapshot.outputs.size(); ++i)
+        {
+            const auto output = node->output(i);
+            if (snapshot.consumers[i] != output.get_target_inputs() ||
+                snapshot.outputs[i].first != output.get_element_type() ||
+                snapshot.outputs[i].second != output.get_partial_shape())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Longest path from the pattern root to the pattern inputs, i.e. how deep the matcher looks
+    // into the graph above the matched node. Recurrent patterns and custom matchers may look
+    // arbitrarily deep.
+    size_t get_pattern_depth(const shared_ptr<pattern::Matcher>& matcher)
+    {
+        if (typeid(*matcher) != typeid(pattern::Matcher))
+        {
+            return unlimited_depth;
+        }
+
+        unordered_map<const Node*, size_t> depths;
+        function<size_t(const Node*)> get_depth = [&](const Node* node) -> size_t {
+            auto it = depths.find(node);
+            if (it != depths.end())
+            {
+                return it->second;
+            }
+            // names are generated on the first request, so they are generated before the
+            // patterns are shared between the threads
+            node->get_name();
+            size_t depth = is_type<pattern::op::Branch>(node) ? unlimited_depth : 0;
+            for (const auto& input : node->input_values())
+            {
+                const size_t input_depth = get_depth(input.get_node());
+                if (depth == unlimited_depth || input_depth == unlimited_depth)
+                {
+                    depth = unlimited_depth;
+                    break;
+                }
+                depth = max(depth, input_depth + 1);
+            }
+            depths[node] = depth;
+            return depth;
+        };
+        return get_depth(matcher->get_pattern_value().get_node());
+    }
+} // namespace
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
 
+    static const bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
+    vector<MatcherStatistics> stats(m_matchers.size());
 
     // Initialize execution queue with nodes in topological order
-    deque<std::shared_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops())
-    {
-        nodes_to_run.emplace_back(node);
-    }
+    const auto ordered_ops = f->get_ordered_ops();
+    deque<std::shared_ptr<Node>> nodes_to_run(ordered_ops.begin(), ordered_ops.end());
 
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
@@ -133,11 +237,159 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // including ones triggered by parent type info.
     }
 
+    // Matchers for the node type including ones registered for its parent types, sorted in order
+    // of the registration. Collected once per type.
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers_for = [&](const Node* node) -> const std::vector<size_t>& {
+        const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+        auto it = node_type_to_matchers.find(node_type_info);
+        if (it != node_type_to_matchers.end())
+        {
+            return it->second;
+        }
+
+        std::vector<size_t> matcher_passes_to_run;
+        for (auto type_info = node_type_info; type_info; type_info = type_info->parent)
+        {
+            auto matchers = type_to_matcher.find(*type_info);
+            if (matchers != type_to_matcher.end())
+            {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        return node_type_to_matchers.emplace(node_type_info, std::move(matcher_passes_to_run))
+            .first->second;
+    };
+
+    // Match the patterns against the initial nodes in parallel. Every node keeps the list of
+    // matchers which patterns matched it and the depth of the graph above the node the patterns
+    // may look at, unlimited if the results can't be reused.
+    std::vector<NodeSnapshot> snapshots;
+    std::vector<std::vector<size_t>> matched_passes;
+    std::vector<size_t> matched_depths;
+    std::unordered_map<const Node*, size_t> node_indices;
+    if (all_roots_has_type && m_parallel_executor)
+    {
+        size_t pairs_count = 0;
+        for (const auto& node : ordered_ops)
+        {
+            pairs_count += get_matchers_for(node.get()).size();
+        }
+
+        if (pairs_count >= parallel_matching_min_pairs)
+        {
+            std::vector<size_t> pattern_depths(m_matchers.size(), unlimited_depth);
+            for (const auto& type_matchers : type_to_matcher)
+            {
+                for (size_t matcher_index : type_matchers.second)
+                {
+                    pattern_depths[matcher_index] =
+                        get_pattern_depth(m_matchers[matcher_index]->get_matcher());
+                }
+            }
+
+            for (const auto& node : ordered_ops)
+            {
+                node->get_name();
+            }
+
+            snapshots.resize(ordered_ops.size());
+            matched_passes.resize(ordered_ops.size());
+            matched_depths.resize(ordered_ops.size(), unlimited_depth);
+
+            const size_t chunk_size =
+                (ordered_ops.size() + parallel_matching_max_chunks - 1) /
+                parallel_matching_max_chunks;
+            const size_t chunks_count = (ordered_ops.size() + chunk_size - 1) / chunk_size;
+            internal::run_parallel(m_parallel_executor, chunks_count, [&](size_t chunk) {
+                // Matchers keep the state of the current match, so every chunk has its own copies
+                std::vector<std::shared_ptr<pattern::Matcher>> matchers(m_matchers.size());
+                const size_t end = std::min(ordered_ops.size(), (chunk + 1) * chunk_size);
+                for (size_t i = chunk * chunk_size; i < end; ++i)
+                {
+                    const auto& node = ordered_ops[i];
+                    take_snapshot(node.get(), snapshots[i]);
+
+                    size_t depth = 0;
+                    for (size_t matcher_index : node_type_to_matchers.at(&node->get_type_info()))
+                    {
+                        // Predicates may look at the inputs of the last matched nodes
+                        depth = pattern_depths[matcher_index] == unlimited_depth
+                                    ? unlimited_depth
+                                    : std::max(depth, pattern_depths[matcher_index] + 1);
+                        if (depth == unlimited_depth)
+                        {
+                            break;
+                        }
+
+                        auto& matcher = matchers[matcher_index];
+                        if (!matcher)
+                        {
+                            auto m = m_matchers[matcher_index]->get_matcher();
+                            matcher = std::make_shared<pattern::Matcher>(
+                                m->get_pattern_value(), m->get_name(), m->is_strict_mode());
+                        }
+
+                        bool matched = true;
+                        try
+                        {
+                            matched = matcher->match(node->output(0));
+                        }
+                        catch (...)
+                        {
+                            // leave the node to the sequential matching which reports the error
+                        }
+                        matcher->clear_state();
+                        if (matched)
+                        {
+                            matched_passes[i].push_back(matcher_index);
+                        }
+                    }
+                    matched_depths[i] = depth;
+                }
+            });
+
+            for (size_t i = 0; i < ordered_ops.size(); ++i)
+            {
+                node_indices[ordered_ops[i].get()] = i;
+                for (size_t matcher_index : matched_passes[i])
+                {
+                    ++stats[matcher_index].matched_in_parallel;
+                }
+            }
+        }
+    }
+
+    // The nodes the pattern may reach must be the same as they were during the parallel matching
+    std::function<bool(const Node*, size_t)> is_unchanged = [&](const Node* node,
+                                                                size_t depth) -> bool {
+        auto it = node_indices.find(node);
+        if (it == node_indices.end() || !is_snapshot_actual(snapshots[it->second], node))
+        {
+            return false;
+        }
+        if (depth == 0)
+        {
+            return true;
+        }
+        for (const auto& input : snapshots[it->second].inputs)
+        {
+            if (!is_unchanged(input.get_node(), depth - 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -151,7 +403,12 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        ++stats[matcher_index].tried;
         bool status = m_pass->apply(node);
+        if (status)
+        {
+            ++stats[matcher_index].applied;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -169,9 +426,6 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
@@ -193,31 +447,30 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // algorithm for finding matchers
         if (all_roots_has_type)
         {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+            const auto& matcher_passes_to_run = get_matchers_for(node.get());
+
+            // Patterns which didn't match the node in parallel won't match it now either if
+            // nothing they may look at has changed since then
+            const std::vector<size_t>* matched = nullptr;
+            if (!matcher_passes_to_run.empty() && !node_indices.empty())
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
+                auto it = node_indices.find(node.get());
+                if (it != node_indices.end() && matched_depths[it->second] != unlimited_depth &&
+                    is_unchanged(node.get(), matched_depths[it->second]))
                 {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
+                    matched = &matched_passes[it->second];
                 }
-                node_type_info = node_type_info->parent;
             }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
             for (size_t matcher_index : matcher_passes_to_run)
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
+                if (matched &&
+                    !std::binary_search(matched->begin(), matched->end(), matcher_index))
+                {
+                    ++stats[matcher_index].skipped;
+                    continue;
+                }
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -227,13 +480,13 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else
         {
-            for (auto& m_pass : m_matchers)
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
             {
                 // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
+                if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
                     continue;
 
-                if (run_matcher_pass(m_pass, node))
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -241,6 +494,20 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
         }
     }
+
+    if (profile_enabled)
+    {
+        for (size_t i = 0; i < m_matchers.size(); ++i)
+        {
+            if (stats[i].tried || stats[i].skipped)
+            {
+                cout << "    " << m_matchers[i]->get_name() << ": tried " << stats[i].tried
+                     << ", skipped " << stats[i].skipped << ", matched in parallel "
+                     << stats[i].matched_in_parallel << ", applied " << stats[i].applied
+                     << "\n";
+            }
+        }
+    }
     return rewritten;
 }
 
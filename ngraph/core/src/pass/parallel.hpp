@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <exception>
+#include <mutex>
+
+#include "ngraph/pass/parallel_executor.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        namespace internal
+        {
+            /// \brief Calls func(i) for i in [0, count) with the executor, or sequentially on the
+            /// calling thread if the executor is empty. The first exception thrown by func is
+            /// rethrown after all the calls are done, so it never escapes into the executor.
+            template <typename Func>
+            void run_parallel(const parallel_executor& executor, size_t count, const Func& func)
+            {
+                if (!executor)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        func(i);
+                    }
+                    return;
+                }
+
+                std::exception_ptr error;
+                std::mutex mutex;
+                executor(count, [&](size_t i) {
+                    try
+                    {
+                        func(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                    }
+                });
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        } // namespace internal
+    }     // namespace pass
+} // namespace ngraph
@@ -0,0 +1,198 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/mmap_object.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+#ifdef _WIN32
+    class HandleHolder
+    {
+    public:
+        explicit HandleHolder(HANDLE handle)
+            : m_handle(handle)
+        {
+        }
+        HandleHolder(const HandleHolder&) = delete;
+        HandleHolder& operator=(const HandleHolder&) = delete;
+        ~HandleHolder()
+        {
+            if (is_valid())
+            {
+                ::CloseHandle(m_handle);
+            }
+        }
+
+        HANDLE get() const noexcept { return m_handle; }
+        bool is_valid() const noexcept
+        {
+            return m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr;
+        }
+
+    private:
+        HANDLE m_handle;
+    };
+
+    class MapHolder : public runtime::MappedMemory
+    {
+    public:
+        MapHolder(const std::string& path, HANDLE file_handle)
+        {
+            HandleHolder file(file_handle);
+            if (!file.is_valid())
+            {
+                throw ngraph_error("Can not open file " + path + " for mapping");
+            }
+            LARGE_INTEGER file_size;
+            if (!::GetFileSizeEx(file.get(), &file_size))
+            {
+                throw ngraph_error("Can not get file size for " + path);
+            }
+            m_size = static_cast<size_t>(file_size.QuadPart);
+            if (m_size == 0)
+            {
+                return;
+            }
+            // copy on write mapping: pages are shared until somebody writes to them
+            HandleHolder mapping(
+                ::CreateFileMappingA(file.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+            if (!mapping.is_valid())
+            {
+                throw ngraph_error("Can not create file mapping for " + path);
+            }
+            m_data =
+                static_cast<char*>(::MapViewOfFile(mapping.get(), FILE_MAP_COPY, 0, 0, m_size));
+            if (m_data == nullptr)
+            {
+                throw ngraph_error("Can not create map view for " + path);
+            }
+        }
+
+        ~MapHolder() override
+        {
+            if (m_data != nullptr)
+            {
+                ::UnmapViewOfFile(m_data);
+            }
+        }
+
+        char* data() noexcept override { return m_data; }
+        size_t size() const noexcept override { return m_size; }
+
+    private:
+        char* m_data = nullptr;
+        size_t m_size = 0;
+    };
+#else
+    class MapHolder : public runtime::MappedMemory
+    {
+    public:
+        explicit MapHolder(const std::string& path)
+        {
+            const int fd = open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+            {
+                throw ngraph_error("Can not open file " + path + " for mapping");
+            }
+            struct stat sb = {};
+            if (fstat(fd, &sb) == -1)
+            {
+                close(fd);
+                throw ngraph_error("Can not get file size for " + path);
+            }
+            m_size = static_cast<size_t>(sb.st_size);
+            if (m_size > 0)
+            {
+                // private writable mapping: pages are shared until somebody writes to them
+                void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED)
+                {
+                    close(fd);
+                    throw ngraph_error("Can not create file mapping for " + path);
+                }
+                m_data = static_cast<char*>(data);
+            }
+            // the mapping stays valid after the descriptor is closed
+            close(fd);
+        }
+
+        ~MapHolder() override
+        {
+            if (m_data != nullptr)
+            {
+                munmap(m_data, m_size);
+            }
+        }
+
+        char* data() noexcept override { return m_data; }
+        size_t size() const noexcept override { return m_size; }
+
+    private:
+        char* m_data = nullptr;
+        size_t m_size = 0;
+    };
+#endif
+}
+
+std::shared_ptr<runtime::MappedMemory> runtime::load_mmap_object(const std::string& path)
+{
+#ifdef _WIN32
+    return std::make_shared<MapHolder>(path,
+                                       ::CreateFileA(path.c_str(),
+                                                     GENERIC_READ,
+                                                     FILE_SHARE_READ,
+                                                     nullptr,
+                                                     OPEN_EXISTING,
+                                                     FILE_ATTRIBUTE_NORMAL,
+                                                     nullptr));
+#else
+    return std::make_shared<MapHolder>(path);
+#endif
+}
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<runtime::MappedMemory> runtime::load_mmap_object(const std::wstring& path)
+{
+#ifdef _WIN32
+    return std::make_shared<MapHolder>(file_util::wstring_to_string(path),
+                                       ::CreateFileW(path.c_str(),
+                                                     GENERIC_READ,
+                                                     FILE_SHARE_READ,
+                                                     nullptr,
+                                                     OPEN_EXISTING,
+                                                     FILE_ATTRIBUTE_NORMAL,
+                                                     nullptr));
+#else
+    return std::make_shared<MapHolder>(file_util::wstring_to_string(path));
+#endif
+}
+#endif
@@ -147,9 +147,10 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
-                            const auto raw_data = tensor_external_data.load_external_data();
+                            const auto buffer = tensor_external_data.load_external_data(sizeof(T));
+                            const auto it = buffer->get_ptr<T>();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            return std::vector<T>(it, it + buffer->size() / sizeof(T));
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -581,8 +582,23 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto) &&
+                    !m_tensor_proto->has_segment())
+                {
+                    // the constant refers to the mapped external file instead of a copy of it
+                    const auto buffer =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_data(sizeof(T));
+                    if (buffer->size() == shape_size(m_shape) * sizeof(T))
+                    {
+                        constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                if (!constant)
+                {
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
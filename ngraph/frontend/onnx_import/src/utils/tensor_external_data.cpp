@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <fstream>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 
 #include "exceptions.hpp"
+#include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "utils/tensor_external_data.hpp"
 
 namespace ngraph
@@ -43,45 +46,68 @@ namespace ngraph
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            namespace
             {
+                /// \brief  Aligned copy of external data which can't be used from the mapping
+                class ExternalDataCopy : public runtime::MappedMemory
+                {
+                public:
+                    ExternalDataCopy(const char* data, size_t size)
+                        : m_buffer(size)
+                    {
+                        std::memcpy(m_buffer.get_ptr(), data, size);
+                    }
+
+                    char* data() noexcept override { return m_buffer.get_ptr<char>(); }
+                    size_t size() const noexcept override { return m_buffer.size(); }
+
+                private:
+                    runtime::AlignedBuffer m_buffer;
+                };
+            }
+
+            std::shared_ptr<ExternalDataBuffer>
+                TensorExternalData::load_external_data(size_t alignment) const
+            {
+                std::shared_ptr<runtime::MappedMemory> memory;
+                try
+                {
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
+                    memory = runtime::load_mmap_object(
+                        file_util::multi_byte_char_to_wstring(m_data_location.c_str()));
 #else
-                std::string path = m_data_location;
+                    memory = runtime::load_mmap_object(m_data_location);
 #endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
-                    throw error::invalid_external_data{*this};
-
-                std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
-                else
-                    read_data_lenght = m_data_lenght;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
+                }
+                catch (const ngraph_error&)
                 {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
+                    throw error::invalid_external_data{*this};
                 }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
+                if (m_offset < 0 || m_data_lenght < 0 ||
+                    static_cast<size_t>(m_offset) > memory->size())
+                    throw error::invalid_external_data{*this};
+
+                const size_t offset = static_cast<size_t>(m_offset);
+                size_t length = static_cast<size_t>(m_data_lenght);
+                if (length == 0) // read entire file
+                    length = memory->size() - offset;
+                else if (offset + length > memory->size())
+                    throw error::invalid_external_data{*this};
 
                 if (m_sha1_digest != 0)
                 {
                     NGRAPH_WARN << "SHA1 checksum is not supported";
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_lenght);
-                external_data_stream.read(&read_data[0], read_data_lenght);
-                external_data_stream.close();
-
-                return read_data;
+                char* data = memory->data() + offset;
+                if (alignment > 1 && reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                {
+                    NGRAPH_DEBUG << "offset " << m_offset << " isn't aligned to " << alignment
+                                 << " bytes, external data is copied instead of mapping";
+                    memory = std::make_shared<ExternalDataCopy>(data, length);
+                    data = memory->data();
+                }
+                return std::make_shared<ExternalDataBuffer>(data, length, memory);
             }
 
             std::string TensorExternalData::to_string() const
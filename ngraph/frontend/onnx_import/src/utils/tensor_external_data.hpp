@@ -16,14 +16,21 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/mmap_object.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            using ExternalDataBuffer =
+                runtime::SharedBuffer<std::shared_ptr<runtime::MappedMemory>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -32,12 +39,17 @@ namespace ngraph
 
                 /// \brief      Load external data from tensor passed to constructor
                 ///
-                /// \note       If read data from external file fails,
+                /// \note       The external file is mapped to memory and the returned buffer is
+                ///             a view of the mapping. If the offset doesn't meet the requested
+                ///             alignment, the data is copied to an aligned buffer.
                 /// \note       If reading data from external files fails,
                 ///             the invalid_external_data exception is thrown.
                 ///
-                /// \return     External binary data loaded into a std::string
-                std::string load_external_data() const;
+                /// \param      alignment  Alignment required for the data, e.g. the size of
+                ///                        the tensor element
+                ///
+                /// \return     Buffer which holds the external binary data
+                std::shared_ptr<ExternalDataBuffer> load_external_data(size_t alignment = 1) const;
 
                 /// \brief      Represets parameter of external data as string
                 ///
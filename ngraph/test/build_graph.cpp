@@ -455,4 +455,59 @@ TEST(build_graph, build_graph_with_remove_parameter_indexing)
     EXPECT_EQ(nodes.size(), 9);
 
     f->validate_nodes_and_infer_types();
-}
\ No newline at end of file
+}
+
+TEST(build_graph, ordered_ops_cache_invalidation)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order, (NodeVector{arg, relu, res}));
+
+    // nodes which aren't connected to the function don't change its topology
+    const auto relu_version = relu->get_topology_version();
+    const auto res_version = res->get_topology_version();
+    auto unused = make_shared<op::Abs>(relu);
+    EXPECT_EQ(relu->get_topology_version(), relu_version);
+    EXPECT_EQ(res->get_topology_version(), res_version);
+    EXPECT_EQ(f->get_ordered_ops(), order);
+
+    // and neither do changes of other functions
+    auto other_arg = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto other_res = make_shared<op::Result>(other_arg);
+    auto other_f = make_shared<Function>(ResultVector{other_res}, ParameterVector{other_arg});
+    other_res->input(0).replace_source_output(make_shared<op::Abs>(other_arg));
+    other_f->add_results(ResultVector{make_shared<op::Result>(other_arg)});
+    EXPECT_EQ(relu->get_topology_version(), relu_version);
+    EXPECT_EQ(res->get_topology_version(), res_version);
+    EXPECT_EQ(f->get_ordered_ops(), order);
+
+    auto abs = make_shared<op::Abs>(relu);
+    res->input(0).replace_source_output(abs);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, abs, res}));
+
+    replace_node(abs, relu);
+    EXPECT_EQ(f->get_ordered_ops(), order);
+
+    auto init_const = op::Constant::create(element::f32, Shape{2, 2}, {0, 0, 0, 0});
+    auto read = make_shared<opset5::ReadValue>(init_const, "v0");
+    auto assign = make_shared<opset5::Assign>(read, "v0");
+    f->add_sinks(SinkVector{assign});
+    EXPECT_EQ(f->get_ordered_ops().size(), 6);
+
+    f->remove_sink(assign);
+    EXPECT_EQ(f->get_ordered_ops(), order);
+
+    auto arg2 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    f->add_parameters(ParameterVector{arg2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    f->remove_parameter(arg2);
+    EXPECT_EQ(f->get_ordered_ops(), order);
+
+    relu->add_control_dependency(arg2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}
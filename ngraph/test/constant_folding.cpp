@@ -3168,3 +3168,73 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, parallel_independent_branches)
+{
+    // Inputs are big enough to evaluate the branches concurrently
+    const Shape shape{64, 1024};
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<float>(i % 17) - 8.f;
+    }
+
+    auto make_function = [&]() {
+        auto data = op::Constant::create(element::f32, shape, values);
+        ResultVector results;
+        for (size_t i = 0; i < 4; i++)
+        {
+            // Abs -> Multiply -> Add chains are folded in three waves
+            auto abs = make_shared<opset5::Abs>(data);
+            auto scale = op::Constant::create(element::f32, Shape{}, {static_cast<float>(i + 1)});
+            auto multiply = make_shared<opset5::Multiply>(abs, scale);
+            auto add = make_shared<opset5::Add>(multiply, scale);
+            add->set_friendly_name("add_" + to_string(i));
+            results.push_back(make_shared<opset5::Result>(add));
+        }
+        return make_shared<Function>(results, ParameterVector{});
+    };
+
+    auto f_parallel = make_function();
+    auto f_serial = make_function();
+    pass::ConstantFolding(make_thread_executor()).run_on_function(f_parallel);
+    pass::ConstantFolding().run_on_function(f_serial);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto parallel_const = as_type_ptr<op::Constant>(
+            f_parallel->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(parallel_const);
+        ASSERT_EQ(parallel_const->get_friendly_name(), "add_" + to_string(i));
+        ASSERT_EQ(parallel_const->get_shape(), shape);
+
+        vector<float> expected(values.size());
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            expected[j] = std::abs(values[j]) * (i + 1) + (i + 1);
+        }
+        range_test_check(parallel_const->cast_vector<float>(), expected);
+        range_test_check(parallel_const->cast_vector<float>(),
+                         get_result_constant<float>(f_serial, i));
+    }
+}
+
+TEST(constant_folding, revalidate_consumers_only)
+{
+    auto param = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto shape_const = op::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto broadcast = make_shared<opset5::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1.f}), shape_const);
+    auto shape_of = make_shared<opset5::ShapeOf>(broadcast);
+    auto reshape = make_shared<opset5::Reshape>(param, shape_of, false);
+    auto f = make_shared<Function>(NodeVector{reshape}, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::ShapeOf>(f), 0);
+    // Reshape consumes the folded shape and must infer the static output shape
+    ASSERT_EQ(reshape->get_output_partial_shape(0), PartialShape({2, 3}));
+}
@@ -267,6 +267,85 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+class TypeBasedReluFusion : public ngraph::pass::MatcherPass
+{
+public:
+    TypeBasedReluFusion()
+        : MatcherPass()
+    {
+        auto relu = std::make_shared<ngraph::opset3::Relu>(
+            std::make_shared<ngraph::opset3::Relu>(std::make_shared<ngraph::pattern::op::Label>()));
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            ngraph::replace_node(m.get_match_root(),
+                                 m.get_match_root()->input_value(0).get_node_shared_ptr());
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "ReluFusion");
+        this->register_matcher(m, callback);
+    }
+};
+
+// Enough nodes to match the patterns in parallel. Relu(Relu) pattern matches only after
+// Divide is replaced, so the results of the parallel matching must not be reused for Relu nodes.
+std::shared_ptr<Function> get_cascade_function()
+{
+    const size_t branches = 3000;
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto divide_constant =
+        ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    ngraph::NodeVector results;
+    for (size_t i = 0; i < branches; ++i)
+    {
+        auto divide = std::make_shared<ngraph::opset3::Divide>(data, divide_constant);
+        results.push_back(std::make_shared<ngraph::opset3::Relu>(divide));
+    }
+    return std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{data});
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassCascade)
+{
+    for (bool parallel : {false, true})
+    {
+        auto f = get_cascade_function();
+
+        Anchor anchor;
+        anchor.set_parallel_matching(parallel ? make_thread_executor() : nullptr);
+        anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+        anchor.add_matcher<TypeBasedReluFusion>();
+        ASSERT_TRUE(anchor.run_on_function(f));
+
+        ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 3000);
+        for (const auto& result : f->get_results())
+        {
+            const auto relu = result->input_value(0).get_node_shared_ptr();
+            ASSERT_TRUE(is_type<opset3::Relu>(relu));
+            ASSERT_TRUE(is_type<opset3::Parameter>(relu->input_value(0).get_node()));
+        }
+    }
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassSkipsUnmatched)
+{
+    for (bool parallel : {false, true})
+    {
+        auto f = get_cascade_function();
+
+        // The callback rejects all the nodes, so nothing is changed whether the unmatched
+        // patterns are skipped or not
+        Anchor anchor;
+        anchor.set_parallel_matching(parallel ? make_thread_executor() : nullptr);
+        anchor.add_matcher<TypeBasedTestPass>();
+        anchor.add_matcher<TypeBasedReluFusion>();
+        ASSERT_FALSE(anchor.run_on_function(f));
+
+        ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 3000);
+        ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 3000);
+    }
+}
+
 TEST(PassConfigTest, Test1)
 {
     {
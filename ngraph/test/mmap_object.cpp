@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/mmap_object.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(mmap_object, content_of_file)
+{
+    const string path = "mmap_object_content.bin";
+    vector<char> content(4099);
+    for (size_t i = 0; i < content.size(); i++)
+    {
+        content[i] = static_cast<char>(i * 37);
+    }
+    {
+        ofstream file(path, ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    {
+        auto memory = runtime::load_mmap_object(path);
+        ASSERT_NE(memory, nullptr);
+        ASSERT_EQ(memory->size(), content.size());
+        ASSERT_NE(memory->data(), nullptr);
+        EXPECT_EQ(vector<char>(memory->data(), memory->data() + memory->size()), content);
+
+        // the mapping is private, so writes don't reach the file
+        memory->data()[0] = static_cast<char>(content[0] + 1);
+    }
+    ifstream file(path, ios::binary);
+    EXPECT_EQ(vector<char>(istreambuf_iterator<char>(file), istreambuf_iterator<char>()), content);
+    file.close();
+
+    remove(path.c_str());
+}
+
+TEST(mmap_object, empty_file)
+{
+    const string path = "mmap_object_empty.bin";
+    ofstream(path, ios::binary).close();
+
+    auto memory = runtime::load_mmap_object(path);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(memory->size(), 0);
+    EXPECT_EQ(memory->data(), nullptr);
+    memory.reset();
+
+    remove(path.c_str());
+}
+
+TEST(mmap_object, missing_file)
+{
+    EXPECT_THROW(runtime::load_mmap_object("mmap_object_missing.bin"), ngraph_error);
+}
@@ -101,6 +101,21 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_unaligned_offset)
+{
+    // the offset of the first tensor doesn't meet alignment of its elements, so the data is
+    // copied instead of being used from the mapped file
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_unaligned_offset.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {1, 2, 3}, second: {1, 2, 3} read from external files
+    test_case.add_input<int32_t>({2, 3, 1});
+
+    test_case.add_expected_output<int32_t>({2, 3, 3});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
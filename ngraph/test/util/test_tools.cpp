@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/util.hpp"
@@ -252,6 +254,29 @@ string get_results_str(const std::vector<char>& ref_data,
     return ::testing::AssertionSuccess();
 }
 
+pass::parallel_executor make_thread_executor(size_t threads_count)
+{
+    return [threads_count](size_t count, const function<void(size_t)>& func) {
+        atomic<size_t> next_index{0};
+        auto work = [&]() {
+            for (size_t i = next_index++; i < count; i = next_index++)
+            {
+                func(i);
+            }
+        };
+        vector<thread> threads;
+        for (size_t i = 1; i < threads_count; ++i)
+        {
+            threads.emplace_back(work);
+        }
+        work();
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    };
+}
+
 constexpr NodeTypeInfo ngraph::TestOpMultiOut::type_info;
 
 bool ngraph::TestOpMultiOut::evaluate(const HostTensorVector& outputs,
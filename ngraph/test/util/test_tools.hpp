@@ -29,6 +29,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/op.hpp"
+#include "ngraph/pass/parallel_executor.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/type/element_type_traits.hpp"
@@ -70,6 +71,10 @@ namespace ngraph
 bool validate_list(const std::vector<std::shared_ptr<ngraph::Node>>& nodes);
 std::shared_ptr<ngraph::Function> make_test_graph();
 
+/// \brief Returns an executor running the calls on threads_count threads including the calling
+/// one, as the executors of the plugins do.
+ngraph::pass::parallel_executor make_thread_executor(size_t threads_count = 4);
+
 template <typename T>
 void copy_data(std::shared_ptr<ngraph::runtime::Tensor> tv, const std::vector<T>& data)
 {